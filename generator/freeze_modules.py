@@ -0,0 +1,166 @@
+#!/usr/bin/python3
+import sys
+import argparse
+import marshal
+import os
+import zipfile
+import importlib.util
+
+
+# Runs at build time (PY3LM_FREEZE_MODULES) and writes the frozen module table compiled into the language module.
+# Marshalled code is tied to the interpreter minor version, so this must run on the same Python as the runtime.
+
+
+def compile_source(name, path):
+    """
+    'path' is None for an empty package, a file path, or a (zip path, member) pair. Members may be sources or
+    bytecode, the Windows runtime ships python312.zip with .pyc files only.
+    """
+    if path is None:
+        source = b''
+    elif isinstance(path, tuple):
+        zip_path, member = path
+        with zipfile.ZipFile(zip_path) as archive:
+            source = archive.read(member)
+        if member.endswith('.pyc'):
+            if source[:4] != importlib.util.MAGIC_NUMBER:
+                raise RuntimeError(f"'{zip_path}/{member}' was compiled by another python version")
+            # 16 byte header: magic, flags and the source mtime and size or hash
+            return marshal.dumps(marshal.loads(source[16:]))
+    else:
+        with open(path, 'rb') as file:
+            source = file.read()
+    code = compile(source, f'<frozen {name}>', 'exec', dont_inherit=True, optimize=0)
+    return marshal.dumps(code)
+
+
+def collect_package(name, package_dir, modules):
+    """
+    Add a package and every module below it. Directories without __init__.py become empty packages.
+    """
+    init_path = os.path.join(package_dir, '__init__.py')
+    modules[name] = (init_path if os.path.isfile(init_path) else None, True)
+    for entry in sorted(os.listdir(package_dir)):
+        path = os.path.join(package_dir, entry)
+        if os.path.isdir(path):
+            if entry != '__pycache__' and not entry.startswith('.') and entry.isidentifier():
+                collect_package(f'{name}.{entry}', path, modules)
+        elif entry.endswith('.py') and entry != '__init__.py':
+            modules[f'{name}.{entry[:-3]}'] = (path, False)
+
+
+def collect_zip(name, zip_path, modules):
+    """
+    Add a module, or a package and every module below it, from a stdlib zip. Sources win over bytecode.
+    """
+    with zipfile.ZipFile(zip_path) as archive:
+        members = set(archive.namelist())
+
+    def find_member(base):
+        for suffix in ('.py', '.pyc'):
+            if base + suffix in members:
+                return base + suffix
+        return None
+
+    prefix = name.replace('.', '/')
+    member = find_member(prefix)
+    if member is not None:
+        modules[name] = ((zip_path, member), False)
+        return
+    if not any(entry.startswith(prefix + '/') for entry in members):
+        raise RuntimeError(f"'{name}' is not a pure python module of '{zip_path}'")
+
+    init = find_member(f'{prefix}/__init__')
+    modules[name] = ((zip_path, init) if init else None, True)
+    children = set()
+    for entry in members:
+        if not entry.startswith(prefix + '/'):
+            continue
+        child = entry[len(prefix) + 1:].split('/')[0]
+        if '/' in entry[len(prefix) + 1:]:
+            if child != '__pycache__' and child.isidentifier():
+                children.add(child)
+        elif child.endswith(('.py', '.pyc')):
+            stem = child.rsplit('.', 1)[0]
+            if stem != '__init__':
+                children.add(stem)
+    for child in sorted(children):
+        collect_zip(f'{name}.{child}', zip_path, modules)
+
+
+def collect_stdlib(name, stdlib_root, modules):
+    """
+    Add a stdlib module from the runtime shipped with the language module, a lib directory or python312.zip.
+    """
+    if zipfile.is_zipfile(stdlib_root):
+        collect_zip(name, stdlib_root, modules)
+        return
+    path = os.path.join(stdlib_root, *name.split('.'))
+    if os.path.isdir(path):
+        collect_package(name, path, modules)
+    elif os.path.isfile(path + '.py'):
+        modules[name] = (path + '.py', False)
+    else:
+        raise RuntimeError(f"'{name}' is not a pure python module of '{stdlib_root}'")
+
+
+def symbol_name(name):
+    return 'kFrozen_' + name.replace('.', '_')
+
+
+def write_table(output_path, modules):
+    lines = [
+        '// Generated by generator/freeze_modules.py, do not edit.',
+        f'// Python {sys.version_info.major}.{sys.version_info.minor}, {len(modules)} modules.',
+        '',
+    ]
+    for name, (path, _) in modules.items():
+        data = compile_source(name, path)
+        lines.append(f'static const unsigned char {symbol_name(name)}[] = {{')
+        for offset in range(0, len(data), 24):
+            lines.append('\t' + ', '.join(f'0x{byte:02x}' for byte in data[offset:offset + 24]) + ',')
+        lines.append('};')
+        lines.append('')
+
+    lines.append('static const struct _frozen kFrozenModules[] = {')
+    for name, (_, is_package) in modules.items():
+        symbol = symbol_name(name)
+        lines.append(f'\t{{ "{name}", {symbol}, static_cast<int>(sizeof({symbol})), {int(is_package)}, nullptr }},')
+    lines.append('\t{ nullptr, nullptr, 0, 0, nullptr }')
+    lines.append('};')
+    lines.append('')
+
+    content = '\n'.join(lines)
+    # Keep the timestamp when nothing changed, so the module is not rebuilt
+    if os.path.isfile(output_path):
+        with open(output_path, 'r', encoding='utf-8') as file:
+            if file.read() == content:
+                return
+    with open(output_path, 'w', encoding='utf-8') as file:
+        file.write(content)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Freeze python modules into a C++ frozen module table.')
+    parser.add_argument('--output', required=True, help='Path of the generated include file.')
+    parser.add_argument('--lib', required=True, help='Language module lib directory, every package in it is frozen.')
+    parser.add_argument('--stdlib', nargs='*', default=[], help='Stdlib modules to freeze, packages include their submodules.')
+    parser.add_argument('--stdlib-root', help='Lib directory or python312.zip of the packaged runtime to read stdlib modules from.')
+    args = parser.parse_args()
+    if args.stdlib and not args.stdlib_root:
+        parser.error('--stdlib requires --stdlib-root, the host stdlib may differ from the packaged runtime')
+
+    modules = {}
+    for entry in sorted(os.listdir(args.lib)):
+        path = os.path.join(args.lib, entry)
+        if os.path.isdir(path) and entry.isidentifier():
+            collect_package(entry, path, modules)
+    for name in args.stdlib:
+        collect_stdlib(name, args.stdlib_root, modules)
+
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    write_table(args.output, modules)
+
+
+if __name__ == '__main__':
+    main()
@@ -1,7 +1,9 @@
 import ast
+import json
 import os
 import importlib.util
-from copy import deepcopy
+from _plugify import Vector2, Vector3, Vector4, Matrix4x4, MatrixView, ArrayView
+from _plugify import release_gil as _release_gil
 
 
 class Plugin:
@@ -26,167 +28,134 @@ class Plugin:
 
 #base_dir, extensions_dir, configs_dir, data_dir, logs_dir, cache_dir
 
+# Argument conversion notes:
+# - char16[] parameters accept a str as well as a list of one-character strings. Every character becomes one
+#   element and the whole str is converted in one pass. Characters outside the BMP raise ValueError.
+# - char16[] values passed to python are always lists of one-character strings, with '' for a zero code unit.
+
+
+def array_views(func):
+    """
+    Mark an exported function to receive numeric and vector array arguments as read-only ArrayView
+    objects instead of lists. A view supports len(), indexing, slicing, iteration, tolist() and the
+    buffer protocol, but it is only valid until the function returns.
+
+    Views of ref params are writable: item assignment, append(), extend(), resize() and clear() modify
+    the caller's array in place. Returning the same view in the result tuple skips the copy back.
+
+    Apply it beneath @staticmethod when both are used.
+    """
+    func.__plugify_array_views__ = True
+    return func
+
+
+def release_gil(func):
+    """
+    Return a copy of a function exported by a native plugin that releases the GIL while the native
+    code runs, so other python threads keep running during slow calls such as file I/O or queries.
+    Arguments are converted before and the result after, both with the GIL held.
+
+    Only use it for exports that do not touch python objects or state without taking the GIL, and
+    keep the copy instead of calling release_gil on every call:
+
+        find_path = release_gil(navigation.find_path)
+    """
+    return _release_gil(func)
+
+
 class PluginInfo:
     def __init__(self, class_name, instance):
         self.class_name = class_name
         self.instance = instance
 
 
-class Vector2:
-    def __init__(self, x=0.0, y=0.0):
-        self.x = x
-        self.y = y
-
-    def __add__(self, other):
-        if isinstance(other, Vector2):
-            return Vector2(self.x + other.x, self.y + other.y)
-        raise ValueError("Can only add another Vector2")
-
-    def __sub__(self, other):
-        if isinstance(other, Vector2):
-            return Vector2(self.x - other.x, self.y - other.y)
-        raise ValueError("Can only subtract another Vector2")
-
-    def __mul__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Vector2(self.x * scalar, self.y * scalar)
-        raise ValueError("Can only multiply by a scalar")
-
-    def __truediv__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Vector2(self.x / scalar, self.y / scalar)
-        raise ValueError("Can only divide by a scalar")
-
-    def __repr__(self):
-        return f"Vector2({self.x}, {self.y})"
-
-
-class Vector3:
-    def __init__(self, x=0.0, y=0.0, z=0.0):
-        self.x = x
-        self.y = y
-        self.z = z
-
-    def __add__(self, other):
-        if isinstance(other, Vector3):
-            return Vector3(self.x + other.x, self.y + other.y, self.z + other.z)
-        raise ValueError("Can only add another Vector3")
-
-    def __sub__(self, other):
-        if isinstance(other, Vector3):
-            return Vector3(self.x - other.x, self.y - other.y, self.z - other.z)
-        raise ValueError("Can only subtract another Vector3")
-
-    def __mul__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Vector3(self.x * scalar, self.y * scalar, self.z * scalar)
-        raise ValueError("Can only multiply by a scalar")
-
-    def __truediv__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Vector3(self.x / scalar, self.y / scalar, self.z / scalar)
-        raise ValueError("Can only divide by a scalar")
-
-    def __repr__(self):
-        return f"Vector3({self.x}, {self.y}, {self.z})"
-
-
-class Vector4:
-    def __init__(self, x=0.0, y=0.0, z=0.0, w=0.0):
-        self.x = x
-        self.y = y
-        self.z = z
-        self.w = w
-
-    def __add__(self, other):
-        if isinstance(other, Vector4):
-            return Vector4(self.x + other.x, self.y + other.y, self.z + other.z, self.w + other.w)
-        raise ValueError("Can only add another Vector4")
-
-    def __sub__(self, other):
-        if isinstance(other, Vector4):
-            return Vector4(self.x - other.x, self.y - other.y, self.z - other.z, self.w - other.w)
-        raise ValueError("Can only subtract another Vector4")
-
-    def __mul__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Vector4(self.x * scalar, self.y * scalar, self.z * scalar, self.w * scalar)
-        raise ValueError("Can only multiply by a scalar")
-
-    def __truediv__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Vector4(self.x / scalar, self.y / scalar, self.z / scalar, self.w / scalar)
-        raise ValueError("Can only divide by a scalar")
-
-    def __repr__(self):
-        return f"Vector4({self.x}, {self.y}, {self.z}, {self.w})"
-
-
-class Matrix4x4:
-    def __init__(self, m=None):
-        if m is None:
-            # Initialize to an identity matrix
-            self.m = [
-                [1.0, 0.0, 0.0, 0.0],
-                [0.0, 1.0, 0.0, 0.0],
-                [0.0, 0.0, 1.0, 0.0],
-                [0.0, 0.0, 0.0, 1.0]
-            ]
-        else:
-            if isinstance(m, list) and len(m) == 16:
-                self.m = [m[0:4], m[4:8], m[8:12], m[12:16]]
-            elif (isinstance(m, list) and len(m) == 4
-                  and all(isinstance(row, list) and len(row) == 4 for row in m)):
-                self.m = m
-            else:
-                raise ValueError("Elements must be a 4x4 or 1x16 list")
-
-    def __add__(self, other):
-        if isinstance(other, Matrix4x4):
-            return Matrix4x4([[self.m[i][j] + other.m[i][j] for j in range(4)] for i in range(4)])
-        raise ValueError("Can only add another Matrix4x4")
-
-    def __sub__(self, other):
-        if isinstance(other, Matrix4x4):
-            return Matrix4x4([[self.m[i][j] - other.m[i][j] for j in range(4)] for i in range(4)])
-        raise ValueError("Can only subtract another Matrix4x4")
-
-    def __mul__(self, other):
-        if isinstance(other, Matrix4x4):
-            result = [[0] * 4 for _ in range(4)]
-            for i in range(4):
-                for j in range(4):
-                    result[i][j] = sum(self.m[i][k] * other.m[k][j] for k in range(4))
-            return Matrix4x4(result)
-        elif isinstance(other, (int, float)):
-            return Matrix4x4([[self.m[i][j] * other for j in range(4)] for i in range(4)])
-        raise ValueError("Can only multiply by another Matrix4x4 or a scalar")
-
-    def __truediv__(self, scalar):
-        if isinstance(scalar, (int, float)):
-            return Matrix4x4([[self.m[i][j] / scalar for j in range(4)] for i in range(4)])
-        raise ValueError("Can only divide by a scalar")
-
-    def __repr__(self):
-        return "\n".join([f"Row {i}: {self.m[i]}" for i in range(4)])
-
-    def transpose(self):
-        return Matrix4x4([[self.m[j][i] for j in range(4)] for i in range(4)])
-
-    @staticmethod
-    def identity():
-        return Matrix4x4()
-
-    @staticmethod
-    def zero():
-        return Matrix4x4([[0.0] * 4 for _ in range(4)])
-
-    @staticmethod
-    def from_list(m):
-        return Matrix4x4(m)
-
-    def to_list(self):
-        return deepcopy(self.m)
+# Direct imports of scanned files keyed by path, valid while mtime and size match. Persisted under the cache dir.
+_SCAN_CACHE_VERSION = 1
+_scan_cache = {}
+_scan_cache_path = None
+_scan_cache_dirty = False
+
+# Session wide state, shared by every plugin load
+_module_origins = {}
+_scanned_modules = set()
+
+
+def _load_scan_cache(cache_path):
+    global _scan_cache, _scan_cache_path, _scan_cache_dirty
+    if cache_path == _scan_cache_path:
+        return
+    _scan_cache_path = cache_path
+    _scan_cache_dirty = False
+    try:
+        with open(cache_path, "r", encoding="utf-8") as file:
+            data = json.load(file)
+        if data.get("version") == _SCAN_CACHE_VERSION:
+            _scan_cache = data.get("files", {})
+    except (OSError, ValueError):
+        pass
+
+
+def _save_scan_cache():
+    global _scan_cache_dirty
+    if not _scan_cache_dirty or not _scan_cache_path:
+        return
+    try:
+        os.makedirs(os.path.dirname(_scan_cache_path), exist_ok=True)
+        temp_path = f"{_scan_cache_path}.{os.getpid()}.tmp"
+        with open(temp_path, "w", encoding="utf-8") as file:
+            json.dump({"version": _SCAN_CACHE_VERSION, "files": _scan_cache}, file)
+        os.replace(temp_path, _scan_cache_path)
+        _scan_cache_dirty = False
+    except OSError as e:
+        print(f"Error saving dependency scan cache {_scan_cache_path}: {e}")
+
+
+def _parse_imports(module_path):
+    """
+    Return the fully qualified names imported by a module file, parsing it only when it changed since the last scan.
+    """
+    global _scan_cache_dirty
+    stat = os.stat(module_path)
+    entry = _scan_cache.get(module_path)
+    if entry and entry["mtime_ns"] == stat.st_mtime_ns and entry["size"] == stat.st_size:
+        return entry["imports"]
+
+    with open(module_path, "r", encoding="utf-8") as file:
+        tree = ast.parse(file.read(), filename=module_path)
+
+    imports = set()
+    for node in ast.walk(tree):
+        if isinstance(node, ast.Import):
+            for alias in node.names:
+                imports.add(alias.name)
+        elif isinstance(node, ast.ImportFrom):
+            if node.module:
+                for alias in node.names:
+                    imports.add(f"{node.module}.{alias.name}")
+
+    imports = sorted(imports)
+    _scan_cache[module_path] = {"mtime_ns": stat.st_mtime_ns, "size": stat.st_size, "imports": imports}
+    _scan_cache_dirty = True
+    return imports
+
+
+def _find_module_path(module_name):
+    """
+    Locate the file path of a given Python module name, ensuring it's a .py file.
+    """
+    # Only hits are remembered, a module missing now may be installed or added to sys.path by a later plugin
+    origin = _module_origins.get(module_name)
+    if origin:
+        return origin
+    try:
+        spec = importlib.util.find_spec(module_name)
+        if spec and spec.origin and spec.origin.endswith(".py"):
+            origin = spec.origin
+            _module_origins[module_name] = origin
+    except Exception as e:
+        #print(f"Error finding module path for {module_name}: {e}")
+        pass
+    return origin
 
 
 def extract_required_modules(module_path, visited=None):
@@ -208,45 +177,34 @@ def extract_required_modules(module_path, visited=None):
         return set()
 
     visited.add(module_path)
-    required_modules = set()
 
     try:
-        with open(module_path, "r", encoding="utf-8") as file:
-            tree = ast.parse(file.read(), filename=module_path)
-        
-        for node in ast.walk(tree):
-            if isinstance(node, ast.Import):
-                for alias in node.names:
-                    required_modules.add(alias.name)
-            elif isinstance(node, ast.ImportFrom):
-                if node.module:
-                    for alias in node.names:
-                        required_modules.add(f"{node.module}.{alias.name}")
+        required_modules = set(_parse_imports(module_path))
     except Exception as e:
         print(f"Error processing {module_path}: {e}")
-        return required_modules
-
-    def find_module_path(module_name):
-        """
-        Locate the file path of a given Python module name, ensuring it's a .py file.
-        """
-        try:
-            spec = importlib.util.find_spec(module_name)
-            if spec and spec.origin and spec.origin.endswith(".py"):
-                return spec.origin
-        except Exception as e:
-            #print(f"Error finding module path for {module_name}: {e}")
-            pass
-        return None
+        return set()
 
     try:
         all_dependencies = set(required_modules)
         for module_name in required_modules:
             base_module = module_name.split('.')[0]
-            module_file = find_module_path(base_module)
+            module_file = _find_module_path(base_module)
             if module_file and os.path.isfile(module_file):
                 all_dependencies.update(extract_required_modules(module_file, visited))
     except Exception as e:
         print(f"Error processing dependencies for {module_path}: {e}")
 
-    return all_dependencies
\ No newline at end of file
+    return all_dependencies
+
+
+def scan_required_modules(module_path, cache_dir=None):
+    """
+    Entry point used by the language module on plugin load. Same as extract_required_modules, but files
+    already scanned for an earlier plugin are skipped and parsed imports are persisted to 'cache_dir'
+    between sessions.
+    """
+    if cache_dir:
+        _load_scan_cache(os.path.join(cache_dir, "python3", "required_modules.json"))
+    required_modules = extract_required_modules(module_path, _scanned_modules)
+    _save_scan_cache()
+    return required_modules
@@ -1,8 +1,23 @@
 #include "module.hpp"
 #include <array>
+#include <atomic>
+#include <cassert>
 #include <climits>
 #include <cuchar>
+#include <cstring>
 #include <bitset>
+#include <bit>
+#include <charconv>
+#include <fstream>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PY3LM_SIMD_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define PY3LM_SIMD_NEON 1
+#endif
 
 #include <plugify/logger.hpp>
 #include <plugify/provider.hpp>
@@ -13,6 +28,10 @@
 
 #include <module_export.h>
 
+#if PY3LM_FROZEN_MODULES
+#include <frozen_modules.inc>
+#endif
+
 #include "plugify/enum_object.hpp"
 #include "plugify/enum_value.hpp"
 
@@ -25,6 +44,128 @@ namespace py3lm {
 	extern Python3LanguageModule g_py3lm;
 
 	namespace {
+		struct ArgsScope;
+	}
+
+	// Converters resolved once per method when its JIT wrapper is generated,
+	// so calls only walk these tables instead of dispatching on every param type
+	struct InternalCallPlan {
+		using ParamConvertionFunc = PyObject* (*)(const Property&, const ParametersSpan&, size_t);
+		using SetReturnFunc = bool (*)(PyObject*, const Property&, ReturnSlot&);
+		using SetRefParamFunc = bool (*)(PyObject*, const Property&, const ParametersSpan&, size_t);
+
+		struct RefParam {
+			size_t paramIndex;
+			SetRefParamFunc setRefParamFunc;
+		};
+
+		PyObject* func{};
+		InterpreterState* state{}; // interpreter of func, entered by calls from C++
+		std::vector<ParamConvertionFunc> paramFuncs;
+		std::vector<RefParam> refParams;
+		SetReturnFunc setReturnFunc{};
+		bool useArrayViews{};
+	};
+
+	struct ExternalCallPlan {
+		using PushParamFunc = bool (*)(const Property&, PyObject*, ArgsScope&);
+		using StoreValueFunc = PyObject* (*)(const Property&, const ArgsScope&, size_t);
+		using BeginCallFunc = void (*)(ArgsScope&);
+		using ReturnToObjectFunc = PyObject* (*)(const Property&, Return&);
+
+		struct RefParam {
+			size_t paramIndex;
+			size_t storageIndex;
+			StoreValueFunc storeValueFunc;
+		};
+
+		const Method* method{};
+		JitCall::CallingFunc func{};
+		std::vector<PushParamFunc> pushParamFuncs;
+		std::vector<RefParam> refParams;
+		BeginCallFunc beginCallFunc{}; // constructs the hidden return slot, null when the result is returned by value
+		ReturnToObjectFunc returnToObjectFunc{};
+		bool hasHiddenParam{};
+		bool releaseGil{}; // set on copies made by _plugify.release_gil
+		std::shared_ptr<void> jitCall; // owns the wrapper behind func, shared with the JIT call cache
+	};
+
+	namespace {
+#ifdef Py_GIL_DISABLED
+		// Shared tables take their own locks without the GIL. They are never held across calls into python,
+		// which may wait for a stop-the-world pause while another thread waits for the lock.
+		using ReadLock = std::shared_lock<std::shared_mutex>;
+		using WriteLock = std::unique_lock<std::shared_mutex>;
+#else
+		// The GIL already serialises access
+		struct NoLock {
+			explicit NoLock(std::shared_mutex&) {}
+		};
+		using ReadLock = NoLock;
+		using WriteLock = NoLock;
+#endif
+
+		// New reference or nullptr when missing. Borrowed dict items may be freed by another thread in
+		// free-threaded builds, so lookups always take a strong reference.
+		PyObject* GetDictItemRef(PyObject* dict, const char* key) {
+#if PY_VERSION_HEX >= 0x030D0000
+			PyObject* value = nullptr;
+			if (PyDict_GetItemStringRef(dict, key, &value) < 0) {
+				PyErr_Clear();
+			}
+			return value;
+#else
+			return Py_XNewRef(PyDict_GetItemString(dict, key));
+#endif
+		}
+
+		bool HasDictItem(PyObject* dict, const char* key) {
+			PyObject* const value = GetDictItemRef(dict, key);
+			Py_XDECREF(value);
+			return value != nullptr;
+		}
+
+		// List item for the duration of a conversion, nullptr with IndexError set past the end. Free-threaded
+		// builds hold a strong reference since another thread may replace the item meanwhile.
+		class ListItem {
+		public:
+			ListItem(PyObject* list, Py_ssize_t index) : _object(Get(list, index)) {}
+#ifdef Py_GIL_DISABLED
+			~ListItem() { Py_XDECREF(_object); }
+#endif
+
+			ListItem(const ListItem&) = delete;
+			ListItem& operator=(const ListItem&) = delete;
+
+			PyObject* get() const { return _object; }
+
+		private:
+			static PyObject* Get(PyObject* list, Py_ssize_t index) {
+#ifdef Py_GIL_DISABLED
+				return PyList_GetItemRef(list, index);
+#else
+				// Converters may run python code which shrinks the list, so the size is checked every time
+				if (index < PyList_GET_SIZE(list)) {
+					return PyList_GET_ITEM(list, index);
+				}
+				PyErr_SetString(PyExc_IndexError, "list index out of range");
+				return nullptr;
+#endif
+			}
+
+			PyObject* _object;
+		};
+
+		// PySequence_Fast, but free-threaded builds snapshot lists into a tuple so borrowed items stay alive
+		PyObject* SequenceFast(PyObject* object, const char* message) {
+#ifdef Py_GIL_DISABLED
+			if (PyList_Check(object)) {
+				return PyList_AsTuple(object);
+			}
+#endif
+			return PySequence_Fast(object, message);
+		}
+
 		void ReplaceAll(std::string& str, const std::string& from, const std::string& to) {
 			size_t start_pos{};
 			while ((start_pos = str.find(from, start_pos)) != std::string::npos) {
@@ -33,7 +174,55 @@ namespace py3lm {
 			}
 		}
 		
+		// ORs 16 byte blocks together and tests the high bits once, the tail is handled a word at a time
+		bool IsAscii(const char* data, size_t size) {
+			size_t i = 0;
+#if PY3LM_SIMD_SSE2
+			__m128i mask = _mm_setzero_si128();
+			for (; i + 16 <= size; i += 16) {
+				mask = _mm_or_si128(mask, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+			}
+			if (_mm_movemask_epi8(mask)) {
+				return false;
+			}
+#elif PY3LM_SIMD_NEON
+			uint8x16_t mask = vdupq_n_u8(0);
+			for (; i + 16 <= size; i += 16) {
+				mask = vorrq_u8(mask, vld1q_u8(reinterpret_cast<const uint8_t*>(data + i)));
+			}
+			if (vmaxvq_u8(mask) & 0x80) {
+				return false;
+			}
+#endif
+			uint64_t word = 0;
+			for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+				uint64_t chunk;
+				std::memcpy(&chunk, data + i, sizeof(uint64_t));
+				word |= chunk;
+			}
+			for (; i < size; ++i) {
+				word |= static_cast<unsigned char>(data[i]);
+			}
+			return (word & 0x8080808080808080ULL) == 0;
+		}
+
+		// Pure ASCII input skips the UTF-8 decoder, the object is allocated at its final size and filled directly
+		PyObject* PyUnicode_FromStringView(std::string_view value) {
+			if (IsAscii(value.data(), value.size())) {
+				PyObject* const object = PyUnicode_New(static_cast<Py_ssize_t>(value.size()), 127);
+				if (object) {
+					std::memcpy(PyUnicode_DATA(object), value.data(), value.size());
+				}
+				return object;
+			}
+			return PyUnicode_FromStringAndSize(value.data(), static_cast<Py_ssize_t>(value.size()));
+		}
+
 		std::string_view PyUnicode_AsString(PyObject* object) {
+			// Compact ASCII data is valid UTF-8 already, no cached copy is created
+			if (PyUnicode_Check(object) && PyUnicode_IS_COMPACT_ASCII(object)) {
+				return { static_cast<const char*>(PyUnicode_DATA(object)), static_cast<size_t>(PyUnicode_GET_LENGTH(object)) };
+			}
 			Py_ssize_t size{};
 			const char *buffer = PyUnicode_AsUTF8AndSize(object, &size);
 			if (buffer) {
@@ -60,18 +249,27 @@ namespace py3lm {
 
 			PyObject *key, *value;
 			Py_ssize_t pos = 0;
+			int result = 1; // Empty
 
+			// Borrowed keys are only safe while the dict is locked in free-threaded builds
+#ifdef Py_GIL_DISABLED
+			Py_BEGIN_CRITICAL_SECTION(moduleDict);
+#endif
 			while (PyDict_Next(moduleDict, &pos, &key, &value)) {
 				std::string_view attribute = PyUnicode_AsString(key);
 				if (!std::any_of(defaultAttrs.begin(), defaultAttrs.end(),
 					 [&attribute](const std::string_view& attr) {
 						 return attribute == attr;
 					 })) {
-					return 0; // Not empty
+					result = 0; // Not empty
+					break;
 				}
 			}
+#ifdef Py_GIL_DISABLED
+			Py_END_CRITICAL_SECTION();
+#endif
 
-			return 1; // Empty
+			return result;
 		}
 
 		bool IsStaticMethod(PyObject* object) {
@@ -84,77 +282,104 @@ namespace py3lm {
 			return false;
 		}
 
-		// Return codes:
-		// [1, 3]	Number bytes used
-		// 0		Sequence starts with \0
-		// -1		Encoding error
-		// -2		Invalid multibyte sequence
-		// -3		Surrogate pair
-		std::pair<int, char16_t> ConvertUtf8ToUtf16(std::string_view sequence) {
-			const auto c8toc16 = [](char ch) -> char16_t { return static_cast<char16_t>(static_cast<uint8_t>(ch)); };
+		bool IsSurrogate(Py_UCS4 ch) {
+			return 0xD800 <= ch && ch < 0xE000;
+		}
 
-			if (sequence.empty()) {
-				return { -2, u'\0' };
+		// Looks for UTF-16 surrogates 8 code units at a time, char16 values must be complete BMP characters
+		bool HasSurrogates(const char16_t* data, size_t size) {
+			size_t i = 0;
+#if PY3LM_SIMD_SSE2
+			const __m128i surrogateMask = _mm_set1_epi16(static_cast<short>(0xF800));
+			const __m128i surrogateBits = _mm_set1_epi16(static_cast<short>(0xD800));
+			__m128i found = _mm_setzero_si128();
+			for (; i + 8 <= size; i += 8) {
+				const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				found = _mm_or_si128(found, _mm_cmpeq_epi16(_mm_and_si128(units, surrogateMask), surrogateBits));
 			}
-			const char seqCh0 = sequence[0];
-			if (seqCh0 == '\0') {
-				return { 0, u'\0' };
+			if (_mm_movemask_epi8(found)) {
+				return true;
 			}
-			if ((seqCh0 & 0b11111000) == 0b11110000) {
-				return { -3, u'\0' };
+#elif PY3LM_SIMD_NEON
+			const uint16x8_t surrogateMask = vdupq_n_u16(0xF800);
+			const uint16x8_t surrogateBits = vdupq_n_u16(0xD800);
+			uint16x8_t found = vdupq_n_u16(0);
+			for (; i + 8 <= size; i += 8) {
+				const uint16x8_t units = vld1q_u16(reinterpret_cast<const uint16_t*>(data + i));
+				found = vorrq_u16(found, vceqq_u16(vandq_u16(units, surrogateMask), surrogateBits));
 			}
-			if ((seqCh0 & 0b11110000) == 0b11100000) {
-				if (sequence.size() < 3) {
-					return { -2, u'\0' };
-				}
-				const char seqCh1 = sequence[1];
-				const char seqCh2 = sequence[2];
-				if ((seqCh1 & 0b11000000) != 0b10000000 || (seqCh2 & 0b11000000) != 0b10000000) {
-					return { -2, u'\0' };
-				}
-				const char16_t ch = (c8toc16(seqCh0 & 0b00001111) << 12) | (c8toc16(seqCh1 & 0b00111111) << 6) | c8toc16(seqCh2 & 0b00111111);
-				if (0xD800 <= static_cast<uint16_t>(ch) && static_cast<uint16_t>(ch) < 0xE000) {
-					return { -1, u'\0' };
-				}
-				return { 3, ch };
+			if (vmaxvq_u16(found)) {
+				return true;
 			}
-			if ((seqCh0 & 0b11100000) == 0b11000000) {
-				if (sequence.size() < 2) {
-					return { -2, u'\0' };
-				}
-				const char seqCh1 = sequence[1];
-				if ((seqCh1 & 0b11000000) != 0b10000000) {
-					return { -2, u'\0' };
+#endif
+			for (; i < size; ++i) {
+				if (IsSurrogate(data[i])) {
+					return true;
 				}
-				const char16_t ch = (c8toc16(seqCh0 & 0b00011111) << 6) | c8toc16(seqCh1 & 0b00111111);
-				return { 2, ch };
 			}
-			if ((seqCh0 & 0b10000000) == 0b00000000) {
-				return { 1, c8toc16(seqCh0) };
-			}
-			return { -1, u'\0' };
+			return false;
 		}
 
-		// Return codes:
-		// [1, 3]	Number bytes returned
-		// 0		For 0x0000 symbol
-		// -1		Surrogate pair
-		std::pair<int, std::array<char, 4>> ConvertUtf16ToUtf8(char16_t ch16) {
-			const auto c16toc8 = [](char16_t ch) -> char { return static_cast<char>(static_cast<uint8_t>(ch)); };
-
-			if (ch16 == u'\0') {
-				return { 0, {} };
+		// Widens latin-1 storage of a PEP 393 string, 16 characters at a time
+		void WidenLatin1(const Py_UCS1* data, size_t size, char16_t* out) {
+			size_t i = 0;
+#if PY3LM_SIMD_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			for (; i + 16 <= size; i += 16) {
+				const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi8(chars, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(chars, zero));
+			}
+#elif PY3LM_SIMD_NEON
+			for (; i + 16 <= size; i += 16) {
+				const uint8x16_t chars = vld1q_u8(data + i);
+				vst1q_u16(reinterpret_cast<uint16_t*>(out + i), vmovl_u8(vget_low_u8(chars)));
+				vst1q_u16(reinterpret_cast<uint16_t*>(out + i + 8), vmovl_u8(vget_high_u8(chars)));
 			}
-			if (static_cast<uint16_t>(ch16) < 0x80) {
-				return { 1, { c16toc8(ch16), '\0' } };
+#endif
+			for (; i < size; ++i) {
+				out[i] = static_cast<char16_t>(data[i]);
 			}
-			if (static_cast<uint16_t>(ch16) < 0x800) {
-				return { 2, { c16toc8(((ch16 & 0b11111000000) >> 6) | 0b11000000), c16toc8((ch16 & 0b111111) | 0b10000000), '\0' } };
+		}
+
+		std::optional<char16_t> Char16FromCodePoint(Py_UCS4 ch) {
+			if (ch > 0xFFFF || IsSurrogate(ch)) {
+				PyErr_SetString(PyExc_ValueError, "Surrogate pair");
+				return std::nullopt;
 			}
-			if (0xD800 <= static_cast<uint16_t>(ch16) && static_cast<uint16_t>(ch16) < 0xE000) {
-				return { -1, {} };
+			return static_cast<char16_t>(ch);
+		}
+
+		// Copies a whole str into char16[] straight from its PEP 393 storage
+		bool FillChar16ArrayFromUnicode(PyObject* object, plg::vector<char16_t>& array) {
+			const auto size = static_cast<size_t>(PyUnicode_GET_LENGTH(object));
+			array.resize(size);
+			switch (PyUnicode_KIND(object)) {
+				case PyUnicode_1BYTE_KIND:
+					WidenLatin1(PyUnicode_1BYTE_DATA(object), size, array.data());
+					return true;
+				case PyUnicode_2BYTE_KIND: {
+					const Py_UCS2* const data = PyUnicode_2BYTE_DATA(object);
+					static_assert(sizeof(Py_UCS2) == sizeof(char16_t));
+					std::memcpy(array.data(), data, size * sizeof(char16_t));
+					if (HasSurrogates(array.data(), size)) {
+						PyErr_SetString(PyExc_ValueError, "Surrogate pair");
+						return false;
+					}
+					return true;
+				}
+				default: {
+					const Py_UCS4* const data = PyUnicode_4BYTE_DATA(object);
+					for (size_t i = 0; i < size; ++i) {
+						auto ch = Char16FromCodePoint(data[i]);
+						if (!ch) {
+							return false;
+						}
+						array[i] = *ch;
+					}
+					return true;
+				}
 			}
-			return { 3, { c16toc8(((ch16 & 0b1111000000000000) >> 12) | 0b11100000), c16toc8(((ch16 & 0b111111000000) >> 6) | 0b10000000), c16toc8((ch16 & 0b111111) | 0b10000000), '\0' } };
 		}
 
 		// Generic function to check if value is in range of type N
@@ -280,23 +505,7 @@ namespace py3lm {
 					return u'\0';
 				}
 				if (length == 1) {
-					auto [rc, ch] = ConvertUtf8ToUtf16(PyUnicode_AsString(object));
-					switch (rc) {
-					case 0:
-					case 1:
-					case 2:
-					case 3:
-						return ch;
-					case -3:
-						PyErr_SetString(PyExc_ValueError, "Surrogate pair");
-						break;
-					case -2:
-						PyErr_SetString(PyExc_ValueError, "Invalid multibyte character");
-						break;
-					case -1:
-						PyErr_SetString(PyExc_RuntimeError, "Encoding error");
-						break;
-					}
+					return Char16FromCodePoint(PyUnicode_READ_CHAR(object, 0));
 				}
 				else {
 					PyErr_SetString(PyExc_ValueError, "Length bigger than 1");
@@ -307,9 +516,6 @@ namespace py3lm {
 			return std::nullopt;
 		}
 
-		template<typename T>
-		std::optional<T> GetObjectAttrAsValue(PyObject* object, const char* attr_name);
-
 		template<class ValueType, class CType, CType (*ConvertFunc)(PyObject*)> requires(std::is_signed_v<ValueType> || std::is_unsigned_v<ValueType>)
 		std::optional<ValueType> ValueFromNumberObject(PyObject* object) {
 			// int or IntEnum
@@ -324,8 +530,18 @@ namespace py3lm {
 				return std::nullopt;
 			}
 			// Enum
-			else if (PyObject_TypeCheck(object, &PyEnum_Type)) {
-				PyObject* value = PyObject_GetAttrString(object, "value");
+			else if (g_py3lm.IsEnumObject(object)) {
+				// Members keep their value in the instance dict, reading it directly skips the 'value' property
+				PyObject* value = nullptr;
+				if (PyObject* const dict = PyObject_GenericGetDict(object, nullptr)) {
+					value = GetDictItemRef(dict, "_value_");
+					Py_DECREF(dict);
+				} else {
+					PyErr_Clear();
+				}
+				if (!value) {
+					value = PyObject_GetAttrString(object, "value");
+				}
 				if (value) {
 					if (PyLong_Check(value)) {
 						const CType castResult = ConvertFunc(value);
@@ -444,6 +660,31 @@ namespace py3lm {
 		template<typename T>
 		std::optional<plg::vector<T>> ArrayFromObject(PyObject* arrayObject);
 
+		// Converts a list which is expected to hold only items of exactly itemType.
+		// Sets mismatch and returns without an error when another type shows up.
+		template<typename T>
+		std::optional<plg::any> AnyArrayFromList(PyObject* listObject, PyTypeObject* itemType, bool& mismatch) {
+			const Py_ssize_t size = PyList_GET_SIZE(listObject);
+			plg::vector<T> array(static_cast<size_t>(size));
+			for (Py_ssize_t i = 0; i < size; ++i) {
+				const ListItem item(listObject, i);
+				PyObject* const valueObject = item.get();
+				if (!valueObject) {
+					return std::nullopt;
+				}
+				if (Py_TYPE(valueObject) != itemType) {
+					mismatch = true;
+					return std::nullopt;
+				}
+				if (auto value = ValueFromObject<T>(valueObject)) {
+					array[static_cast<size_t>(i)] = std::move(*value);
+					continue;
+				}
+				return std::nullopt;
+			}
+			return array;
+		}
+
 		template<>
 		std::optional<plg::any> ValueFromObject(PyObject* object) {
 			auto [type, name] = g_py3lm.GetObjectType(object);
@@ -462,10 +703,53 @@ namespace py3lm {
 					if (size == 0) {
 						return plg::vector<int64_t>();
 					}
+					// Speculate that the list is homogeneous and let the first item pick the element type,
+					// so common lists are classified once and walked once
+					const ListItem firstItem(object, 0);
+					PyObject* const firstObject = firstItem.get();
+					if (!firstObject) {
+						return std::nullopt;
+					}
+					PyTypeObject* const firstType = Py_TYPE(firstObject);
+					bool mismatch = false;
+					std::optional<plg::any> speculated;
+					switch (g_py3lm.GetObjectType(firstObject).type) {
+						case PyAbstractType::Long:
+							speculated = AnyArrayFromList<int64_t>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Bool:
+							speculated = AnyArrayFromList<bool>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Float:
+							speculated = AnyArrayFromList<double>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Unicode:
+							speculated = AnyArrayFromList<plg::string>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Vector2:
+							speculated = AnyArrayFromList<plg::vec2>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Vector3:
+							speculated = AnyArrayFromList<plg::vec3>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Vector4:
+							speculated = AnyArrayFromList<plg::vec4>(object, firstType, mismatch);
+							break;
+						case PyAbstractType::Matrix4x4:
+							speculated = AnyArrayFromList<plg::mat4x4>(object, firstType, mismatch);
+							break;
+						default:
+							mismatch = true;
+							break;
+					}
+					if (!mismatch) {
+						return speculated;
+					}
+					// Mixed or unsupported items, classify all of them to pick a type or report the error
 					std::bitset<MaxPyTypes> flags;
 					for (Py_ssize_t i = 0; i < size; i++) {
-						PyObject* const valueObject = PyList_GetItem(object, i);
-						if (valueObject) {
+						const ListItem item(object, i);
+						if (PyObject* const valueObject = item.get()) {
 							auto [valueType, _] = g_py3lm.GetObjectType(valueObject);
 							if (valueType != PyAbstractType::Invalid) {
 								flags.set(static_cast<size_t>(valueType));
@@ -532,8 +816,11 @@ namespace py3lm {
 					std::string error("List should contains supported types, but contains: [");
 					bool first = true;
 					for (Py_ssize_t i = 0; i < size; i++) {
-						PyObject* const valueObject = PyList_GetItem(object, i);
-						auto [_, valueName] = g_py3lm.GetObjectType(valueObject);
+						const ListItem item(object, i);
+						if (!item.get()) {
+							return std::nullopt;
+						}
+						auto [_, valueName] = g_py3lm.GetObjectType(item.get());
 						if (first) {
 							std::format_to(std::back_inserter(error), "'{}", valueName);
 							first = false;
@@ -578,44 +865,204 @@ namespace py3lm {
 			return g_py3lm.Matrix4x4ValueFromObject(object);
 		}
 
+		// Element types which can be ingested straight from objects supporting the buffer protocol
+		template<class T>
+		constexpr bool is_buffer_element_v = std::is_arithmetic_v<T> &&
+				!std::is_same_v<T, bool> &&
+				!std::is_same_v<T, char> &&
+				!std::is_same_v<T, char16_t>;
+
+		// Element types which can be passed to python as ArrayView
+		template<class T>
+		constexpr bool is_array_view_element_v = is_buffer_element_v<T> ||
+				std::is_same_v<T, void*> ||
+				std::is_same_v<T, plg::vec2> ||
+				std::is_same_v<T, plg::vec3> ||
+				std::is_same_v<T, plg::vec4> ||
+				std::is_same_v<T, plg::mat4x4>;
+
+		// True when every value of From is representable in To
+		template<typename From, typename To>
+		constexpr bool is_lossless_conversion_v = [] {
+			if constexpr (std::is_floating_point_v<From> && std::is_floating_point_v<To>) {
+				return sizeof(From) <= sizeof(To);
+			} else if constexpr (std::is_integral_v<From> && std::is_integral_v<To>) {
+				if constexpr (std::is_signed_v<To>) {
+					return std::is_signed_v<From> ? sizeof(From) <= sizeof(To) : sizeof(From) < sizeof(To);
+				} else {
+					return std::is_unsigned_v<From> && sizeof(From) <= sizeof(To);
+				}
+			} else {
+				return false;
+			}
+		}();
+
+		template<typename From, typename To>
+		bool CopyBufferElements(const void* data, size_t count, plg::vector<To>& array) {
+			if constexpr (is_lossless_conversion_v<From, To>) {
+				array.resize(count);
+				if constexpr (std::is_same_v<From, To>) {
+					std::memcpy(array.data(), data, count * sizeof(To));
+				} else {
+					// Buffer memory is not guaranteed to be aligned for From (e.g. casted memoryview slices)
+					const auto* bytes = static_cast<const std::byte*>(data);
+					To* out = array.data();
+					for (size_t i = 0; i < count; ++i) {
+						From value;
+						std::memcpy(&value, bytes + i * sizeof(From), sizeof(From));
+						out[i] = static_cast<To>(value);
+					}
+				}
+				return true;
+			} else {
+				return false;
+			}
+		}
+
+		// Parses a single-item struct format ('B', '<i', '@d', ...) into kind ('i', 'u' or 'f') and native item size
+		std::optional<std::pair<char, Py_ssize_t>> ParseBufferFormat(const char* format, Py_ssize_t itemSize) {
+			if (!format) {
+				return std::pair{ 'u', Py_ssize_t{1} };
+			}
+			constexpr char nativeOrder = std::endian::native == std::endian::little ? '<' : '>';
+			if (*format == '@' || *format == '=' || *format == nativeOrder || (nativeOrder == '>' && *format == '!')) {
+				++format;
+			}
+			if (format[0] == '\0' || format[1] != '\0') {
+				return std::nullopt;
+			}
+			switch (format[0]) {
+				case 'b':
+				case 'h':
+				case 'i':
+				case 'l':
+				case 'q':
+				case 'n':
+					return std::pair{ 'i', itemSize };
+				case 'B':
+				case 'H':
+				case 'I':
+				case 'L':
+				case 'Q':
+				case 'N':
+					return std::pair{ 'u', itemSize };
+				case 'f':
+				case 'd':
+					return std::pair{ 'f', itemSize };
+				default:
+					return std::nullopt;
+			}
+		}
+
 		template<typename T>
-		std::optional<plg::vector<T>> ArrayFromObject(PyObject* arrayObject) {
+		bool CopyBufferArray(const Py_buffer& view, plg::vector<T>& array) {
+			const auto format = ParseBufferFormat(view.format, view.itemsize);
+			if (!format) {
+				return false;
+			}
+			const void* data = view.buf;
+			const auto count = static_cast<size_t>(view.len / view.itemsize);
+			switch (format->first) {
+				case 'i':
+					switch (format->second) {
+						case 1: return CopyBufferElements<int8_t>(data, count, array);
+						case 2: return CopyBufferElements<int16_t>(data, count, array);
+						case 4: return CopyBufferElements<int32_t>(data, count, array);
+						case 8: return CopyBufferElements<int64_t>(data, count, array);
+						default: return false;
+					}
+				case 'u':
+					switch (format->second) {
+						case 1: return CopyBufferElements<uint8_t>(data, count, array);
+						case 2: return CopyBufferElements<uint16_t>(data, count, array);
+						case 4: return CopyBufferElements<uint32_t>(data, count, array);
+						case 8: return CopyBufferElements<uint64_t>(data, count, array);
+						default: return false;
+					}
+				case 'f':
+					switch (format->second) {
+						case 4: return CopyBufferElements<float>(data, count, array);
+						case 8: return CopyBufferElements<double>(data, count, array);
+						default: return false;
+					}
+				default:
+					return false;
+			}
+		}
+
+		template<typename T>
+		bool FillArrayFromBufferObject(PyObject* arrayObject, plg::vector<T>& array) {
+			Py_buffer view;
+			if (PyObject_GetBuffer(arrayObject, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+				PyErr_Clear();
+				SetTypeError("Expected list or C-contiguous buffer", arrayObject);
+				return false;
+			}
+			const bool copied = view.ndim <= 1 && view.itemsize > 0 && CopyBufferArray(view, array);
+			if (!copied) {
+				const std::string error(std::format("Buffer with format '{}' and {} dimension(s) can't be converted to array without loss", view.format ? view.format : "B", view.ndim));
+				PyErr_SetString(PyExc_TypeError, error.c_str());
+			}
+			PyBuffer_Release(&view);
+			return copied;
+		}
+
+		bool IsArrayViewObject(PyObject* object);
+
+		template<typename T>
+		bool FillArrayFromArrayViewObject(PyObject* object, plg::vector<T>& array);
+
+		// Fills an existing (possibly pooled) array, so its capacity is reused
+		template<typename T>
+		bool FillArrayFromObject(PyObject* arrayObject, plg::vector<T>& array) {
 			if (!PyList_Check(arrayObject)) {
+				// A whole str converts in one pass instead of one object per character
+				if constexpr (std::is_same_v<T, char16_t>) {
+					if (PyUnicode_Check(arrayObject)) {
+						return FillChar16ArrayFromUnicode(arrayObject, array);
+					}
+				}
+				// Views handed out by InternalCall, copied directly when the item type matches
+				if constexpr (is_array_view_element_v<T>) {
+					if (IsArrayViewObject(arrayObject) && FillArrayFromArrayViewObject<T>(arrayObject, array)) {
+						return true;
+					}
+				}
+				// bytes, bytearray, array.array, memoryview, numpy arrays, ...
+				if constexpr (is_buffer_element_v<T>) {
+					if (PyObject_CheckBuffer(arrayObject)) {
+						return FillArrayFromBufferObject<T>(arrayObject, array);
+					}
+				}
 				SetTypeError("Expected list", arrayObject);
-				return std::nullopt;
+				return false;
 			}
 			const Py_ssize_t size = PyList_Size(arrayObject);
-			plg::vector<T> array(static_cast<size_t>(size));
+			array.resize(static_cast<size_t>(size));
 			for (Py_ssize_t i = 0; i < size; ++i) {
-				if (PyObject* const valueObject = PyList_GetItem(arrayObject, i)) {
+				const ListItem item(arrayObject, i);
+				if (PyObject* const valueObject = item.get()) {
 					if (auto value = ValueFromObject<T>(valueObject)) {
 						array[static_cast<size_t>(i)] = std::move(*value);
 						continue;
 					}
 				}
-				return std::nullopt;
+				return false;
 			}
-			return array;
-		}
-
-		std::optional<void*> GetOrCreateFunctionValue(const Method& method, PyObject* object) {
-			return g_py3lm.GetOrCreateFunctionValue(method, object);
+			return true;
 		}
 
 		template<typename T>
-		void* CreateValue(PyObject* pItem) {
-			if (auto value = ValueFromObject<T>(pItem)) {
-				return new T(std::move(*value));
+		std::optional<plg::vector<T>> ArrayFromObject(PyObject* arrayObject) {
+			plg::vector<T> array;
+			if (FillArrayFromObject(arrayObject, array)) {
+				return array;
 			}
-			return nullptr;
+			return std::nullopt;
 		}
 
-		template<typename T>
-		void* CreateArray(PyObject* pItem) {
-			if (auto array = ArrayFromObject<T>(pItem)) {
-				return new plg::vector<T>(std::move(*array));
-			}
-			return nullptr;
+		std::optional<void*> GetOrCreateFunctionValue(const Method& method, PyObject* object) {
+			return g_py3lm.GetOrCreateFunctionValue(method, object);
 		}
 
 		void SetFallbackReturn(ValueType retType, ReturnSlot& ret) {
@@ -728,556 +1175,251 @@ namespace py3lm {
 			}
 		}
 
-		bool SetReturn(PyObject* result, const Property& retType, ReturnSlot& ret) {
+		using SetReturnFunc = InternalCallPlan::SetReturnFunc;
+
+		bool SetVoidReturn([[maybe_unused]] PyObject* result, [[maybe_unused]] const Property& retType, [[maybe_unused]] ReturnSlot& ret) {
+			return true;
+		}
+
+		template<typename T>
+		bool SetValueReturn(PyObject* result, [[maybe_unused]] const Property& retType, ReturnSlot& ret) {
+			if (auto value = ValueFromObject<T>(result)) {
+				ret.Set<T>(*value);
+				return true;
+			}
+			return false;
+		}
+
+		template<typename T>
+		bool ConstructValueReturn(PyObject* result, [[maybe_unused]] const Property& retType, ReturnSlot& ret) {
+			if (auto value = ValueFromObject<T>(result)) {
+				ret.Construct<T>(std::move(*value));
+				return true;
+			}
+			return false;
+		}
+
+		template<typename T>
+		bool ConstructArrayReturn(PyObject* result, [[maybe_unused]] const Property& retType, ReturnSlot& ret) {
+			if (auto value = ArrayFromObject<T>(result)) {
+				ret.Construct<plg::vector<T>>(std::move(*value));
+				return true;
+			}
+			return false;
+		}
+
+		bool SetFunctionReturn(PyObject* result, const Property& retType, ReturnSlot& ret) {
+			if (auto value = GetOrCreateFunctionValue(*retType.GetPrototype(), result)) {
+				ret.Set<void*>(*value);
+				return true;
+			}
+			return false;
+		}
+
+		SetReturnFunc GetSetReturnFunc(const Property& retType) {
 			switch (retType.GetType()) {
 			case ValueType::Void:
-				return true;
+				return &SetVoidReturn;
 			case ValueType::Bool:
-				if (auto value = ValueFromObject<bool>(result)) {
-					ret.Set<bool>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<bool>;
 			case ValueType::Char8:
-				if (auto value = ValueFromObject<char>(result)) {
-					ret.Set<char>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<char>;
 			case ValueType::Char16:
-				if (auto value = ValueFromObject<char16_t>(result)) {
-					ret.Set<char16_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<char16_t>;
 			case ValueType::Int8:
-				if (auto value = ValueFromObject<int8_t>(result)) {
-					ret.Set<int8_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<int8_t>;
 			case ValueType::Int16:
-				if (auto value = ValueFromObject<int16_t>(result)) {
-					ret.Set<int16_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<int16_t>;
 			case ValueType::Int32:
-				if (auto value = ValueFromObject<int32_t>(result)) {
-					ret.Set<int32_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<int32_t>;
 			case ValueType::Int64:
-				if (auto value = ValueFromObject<int64_t>(result)) {
-					ret.Set<int64_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<int64_t>;
 			case ValueType::UInt8:
-				if (auto value = ValueFromObject<uint8_t>(result)) {
-					ret.Set<uint8_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<uint8_t>;
 			case ValueType::UInt16:
-				if (auto value = ValueFromObject<uint16_t>(result)) {
-					ret.Set<uint16_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<uint16_t>;
 			case ValueType::UInt32:
-				if (auto value = ValueFromObject<uint32_t>(result)) {
-					ret.Set<uint32_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<uint32_t>;
 			case ValueType::UInt64:
-				if (auto value = ValueFromObject<uint64_t>(result)) {
-					ret.Set<uint64_t>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<uint64_t>;
 			case ValueType::Pointer:
-				if (auto value = ValueFromObject<void*>(result)) {
-					ret.Set<void*>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<void*>;
 			case ValueType::Float:
-				if (auto value = ValueFromObject<float>(result)) {
-					ret.Set<float>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<float>;
 			case ValueType::Double:
-				if (auto value = ValueFromObject<double>(result)) {
-					ret.Set<double>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<double>;
 			case ValueType::Function:
-				if (auto value = GetOrCreateFunctionValue(*retType.GetPrototype(), result)) {
-					ret.Set<void*>(*value);
-					return true;
-				}
-				break;
+				return &SetFunctionReturn;
 			case ValueType::String:
-				if (auto value = ValueFromObject<plg::string>(result)) {
-					ret.Construct<plg::string>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructValueReturn<plg::string>;
 			case ValueType::Any:
-				if (auto value = ValueFromObject<plg::any>(result)) {
-					ret.Construct<plg::any>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructValueReturn<plg::any>;
 			case ValueType::ArrayBool:
-				if (auto value = ArrayFromObject<bool>(result)) {
-					ret.Construct<plg::vector<bool>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<bool>;
 			case ValueType::ArrayChar8:
-				if (auto value = ArrayFromObject<char>(result)) {
-					ret.Construct<plg::vector<char>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<char>;
 			case ValueType::ArrayChar16:
-				if (auto value = ArrayFromObject<char16_t>(result)) {
-					ret.Construct<plg::vector<char16_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<char16_t>;
 			case ValueType::ArrayInt8:
-				if (auto value = ArrayFromObject<int8_t>(result)) {
-					ret.Construct<plg::vector<int8_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<int8_t>;
 			case ValueType::ArrayInt16:
-				if (auto value = ArrayFromObject<int16_t>(result)) {
-					ret.Construct<plg::vector<int16_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<int16_t>;
 			case ValueType::ArrayInt32:
-				if (auto value = ArrayFromObject<int32_t>(result)) {
-					ret.Construct<plg::vector<int32_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<int32_t>;
 			case ValueType::ArrayInt64:
-				if (auto value = ArrayFromObject<int64_t>(result)) {
-					ret.Construct<plg::vector<int64_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<int64_t>;
 			case ValueType::ArrayUInt8:
-				if (auto value = ArrayFromObject<uint8_t>(result)) {
-					ret.Construct<plg::vector<uint8_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<uint8_t>;
 			case ValueType::ArrayUInt16:
-				if (auto value = ArrayFromObject<uint16_t>(result)) {
-					ret.Construct<plg::vector<uint16_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<uint16_t>;
 			case ValueType::ArrayUInt32:
-				if (auto value = ArrayFromObject<uint32_t>(result)) {
-					ret.Construct<plg::vector<uint32_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<uint32_t>;
 			case ValueType::ArrayUInt64:
-				if (auto value = ArrayFromObject<uint64_t>(result)) {
-					ret.Construct<plg::vector<uint64_t>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<uint64_t>;
 			case ValueType::ArrayPointer:
-				if (auto value = ArrayFromObject<void*>(result)) {
-					ret.Construct<plg::vector<void*>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<void*>;
 			case ValueType::ArrayFloat:
-				if (auto value = ArrayFromObject<float>(result)) {
-					ret.Construct<plg::vector<float>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<float>;
 			case ValueType::ArrayDouble:
-				if (auto value = ArrayFromObject<double>(result)) {
-					ret.Construct<plg::vector<double>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<double>;
 			case ValueType::ArrayString:
-				if (auto value = ArrayFromObject<plg::string>(result)) {
-					ret.Construct<plg::vector<plg::string>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<plg::string>;
 			case ValueType::ArrayAny:
-				if (auto value = ArrayFromObject<plg::any>(result)) {
-					ret.Construct<plg::vector<plg::any>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<plg::any>;
 			case ValueType::ArrayVector2:
-				if (auto value = ArrayFromObject<plg::vec2>(result)) {
-					ret.Construct<plg::vector<plg::vec2>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<plg::vec2>;
 			case ValueType::ArrayVector3:
-				if (auto value = ArrayFromObject<plg::vec3>(result)) {
-					ret.Construct<plg::vector<plg::vec3>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<plg::vec3>;
 			case ValueType::ArrayVector4:
-				if (auto value = ArrayFromObject<plg::vec4>(result)) {
-					ret.Construct<plg::vector<plg::vec4>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<plg::vec4>;
 			case ValueType::ArrayMatrix4x4:
-				if (auto value = ArrayFromObject<plg::mat4x4>(result)) {
-					ret.Construct<plg::vector<plg::mat4x4>>(std::move(*value));
-					return true;
-				}
-				break;
+				return &ConstructArrayReturn<plg::mat4x4>;
 			case ValueType::Vector2:
-				if (auto value = ValueFromObject<plg::vec2>(result)) {
-					ret.Set<plg::vec2>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<plg::vec2>;
 			case ValueType::Vector3:
-				if (auto value = ValueFromObject<plg::vec3>(result)) {
-					ret.Set<plg::vec3>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<plg::vec3>;
 			case ValueType::Vector4:
-				if (auto value = ValueFromObject<plg::vec4>(result)) {
-					ret.Set<plg::vec4>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<plg::vec4>;
 			case ValueType::Matrix4x4:
-				if (auto value = ValueFromObject<plg::mat4x4>(result)) {
-					ret.Set<plg::mat4x4>(*value);
-					return true;
-				}
-				break;
+				return &SetValueReturn<plg::mat4x4>;
 			default: {
 				const std::string error(std::format(LOG_PREFIX "SetReturn unsupported type {:#x}", static_cast<uint8_t>(retType.GetType())));
 				g_py3lm.LogFatal(error);
 				std::terminate();
+				return nullptr;
+			}
 			}
+		}
+
+		using SetRefParamFunc = InternalCallPlan::SetRefParamFunc;
+
+		template<typename T>
+		bool SetRefParamValue(PyObject* object, [[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			if (auto value = ValueFromObject<T>(object)) {
+				*params.Get<T*>(index) = std::move(*value);
+				return true;
 			}
+			return false;
+		}
 
+		template<typename T>
+		bool SetRefParamArray(PyObject* object, [[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			if (auto value = ArrayFromObject<T>(object)) {
+				*params.Get<plg::vector<T>*>(index) = std::move(*value);
+				return true;
+			}
 			return false;
 		}
 
-		bool SetRefParam(PyObject* object, const Property& paramType, const ParametersSpan& params, size_t index) {
+		SetRefParamFunc GetSetRefParamFunc(const Property& paramType) {
 			switch (paramType.GetType()) {
 			case ValueType::Bool:
-				if (auto value = ValueFromObject<bool>(object)) {
-					auto* const param = params.Get<bool*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<bool>;
 			case ValueType::Char8:
-				if (auto value = ValueFromObject<char>(object)) {
-					auto* const param = params.Get<char*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<char>;
 			case ValueType::Char16:
-				if (auto value = ValueFromObject<char16_t>(object)) {
-					auto* const param = params.Get<char16_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<char16_t>;
 			case ValueType::Int8:
-				if (auto value = ValueFromObject<int8_t>(object)) {
-					auto* const param = params.Get<int8_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<int8_t>;
 			case ValueType::Int16:
-				if (auto value = ValueFromObject<int16_t>(object)) {
-					auto* const param = params.Get<int16_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<int16_t>;
 			case ValueType::Int32:
-				if (auto value = ValueFromObject<int32_t>(object)) {
-					auto* const param = params.Get<int32_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<int32_t>;
 			case ValueType::Int64:
-				if (auto value = ValueFromObject<int64_t>(object)) {
-					auto* const param = params.Get<int64_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<int64_t>;
 			case ValueType::UInt8:
-				if (auto value = ValueFromObject<uint8_t>(object)) {
-					auto* const param = params.Get<uint8_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<uint8_t>;
 			case ValueType::UInt16:
-				if (auto value = ValueFromObject<uint16_t>(object)) {
-					auto* const param = params.Get<uint16_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<uint16_t>;
 			case ValueType::UInt32:
-				if (auto value = ValueFromObject<uint32_t>(object)) {
-					auto* const param = params.Get<uint32_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<uint32_t>;
 			case ValueType::UInt64:
-				if (auto value = ValueFromObject<uint64_t>(object)) {
-					auto* const param = params.Get<uint64_t*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<uint64_t>;
 			case ValueType::Pointer:
-				if (auto value = ValueFromObject<void*>(object)) {
-					auto* const param = params.Get<void**>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<void*>;
 			case ValueType::Float:
-				if (auto value = ValueFromObject<float>(object)) {
-					auto* const param = params.Get<float*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<float>;
 			case ValueType::Double:
-				if (auto value = ValueFromObject<double>(object)) {
-					auto* const param = params.Get<double*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<double>;
 			case ValueType::String:
-				if (auto value = ValueFromObject<plg::string>(object)) {
-					auto* const param = params.Get<plg::string*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamValue<plg::string>;
 			case ValueType::Any:
-				if (auto value = ValueFromObject<plg::any>(object)) {
-					auto* const param = params.Get<plg::any*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamValue<plg::any>;
 			case ValueType::ArrayBool:
-				if (auto value = ArrayFromObject<bool>(object)) {
-					auto* const param = params.Get<plg::vector<bool>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<bool>;
 			case ValueType::ArrayChar8:
-				if (auto value = ArrayFromObject<char>(object)) {
-					auto* const param = params.Get<plg::vector<char>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<char>;
 			case ValueType::ArrayChar16:
-				if (auto value = ArrayFromObject<char16_t>(object)) {
-					auto* const param = params.Get<plg::vector<char16_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<char16_t>;
 			case ValueType::ArrayInt8:
-				if (auto value = ArrayFromObject<int8_t>(object)) {
-					auto* const param = params.Get<plg::vector<int8_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<int8_t>;
 			case ValueType::ArrayInt16:
-				if (auto value = ArrayFromObject<int16_t>(object)) {
-					auto* const param = params.Get<plg::vector<int16_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<int16_t>;
 			case ValueType::ArrayInt32:
-				if (auto value = ArrayFromObject<int32_t>(object)) {
-					auto* const param = params.Get<plg::vector<int32_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<int32_t>;
 			case ValueType::ArrayInt64:
-				if (auto value = ArrayFromObject<int64_t>(object)) {
-					auto* const param = params.Get<plg::vector<int64_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<int64_t>;
 			case ValueType::ArrayUInt8:
-				if (auto value = ArrayFromObject<uint8_t>(object)) {
-					auto* const param = params.Get<plg::vector<uint8_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<uint8_t>;
 			case ValueType::ArrayUInt16:
-				if (auto value = ArrayFromObject<uint16_t>(object)) {
-					auto* const param = params.Get<plg::vector<uint16_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<uint16_t>;
 			case ValueType::ArrayUInt32:
-				if (auto value = ArrayFromObject<uint32_t>(object)) {
-					auto* const param = params.Get<plg::vector<uint32_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<uint32_t>;
 			case ValueType::ArrayUInt64:
-				if (auto value = ArrayFromObject<uint64_t>(object)) {
-					auto* const param = params.Get<plg::vector<uint64_t>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<uint64_t>;
 			case ValueType::ArrayPointer:
-				if (auto value = ArrayFromObject<void*>(object)) {
-					auto* const param = params.Get<plg::vector<void*>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<void*>;
 			case ValueType::ArrayFloat:
-				if (auto value = ArrayFromObject<float>(object)) {
-					auto* const param = params.Get<plg::vector<float>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<float>;
 			case ValueType::ArrayDouble:
-				if (auto value = ArrayFromObject<double>(object)) {
-					auto* const param = params.Get<plg::vector<double>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<double>;
 			case ValueType::ArrayString:
-				if (auto value = ArrayFromObject<plg::string>(object)) {
-					auto* const param = params.Get<plg::vector<plg::string>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<plg::string>;
 			case ValueType::ArrayAny:
-				if (auto value = ArrayFromObject<plg::any>(object)) {
-					auto* const param = params.Get<plg::vector<plg::any>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<plg::any>;
 			case ValueType::ArrayVector2:
-				if (auto value = ArrayFromObject<plg::vec2>(object)) {
-					auto* const param = params.Get<plg::vector<plg::vec2>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<plg::vec2>;
 			case ValueType::ArrayVector3:
-				if (auto value = ArrayFromObject<plg::vec3>(object)) {
-					auto* const param = params.Get<plg::vector<plg::vec3>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<plg::vec3>;
 			case ValueType::ArrayVector4:
-				if (auto value = ArrayFromObject<plg::vec4>(object)) {
-					auto* const param = params.Get<plg::vector<plg::vec4>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<plg::vec4>;
 			case ValueType::ArrayMatrix4x4:
-				if (auto value = ArrayFromObject<plg::mat4x4>(object)) {
-					auto* const param = params.Get<plg::vector<plg::mat4x4>*>(index);
-					*param = std::move(*value);
-					return true;
-				}
-				break;
+				return &SetRefParamArray<plg::mat4x4>;
 			case ValueType::Vector2:
-				if (auto value = ValueFromObject<plg::vec2>(object)) {
-					auto* const param = params.Get<plg::vec2*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<plg::vec2>;
 			case ValueType::Vector3:
-				if (auto value = ValueFromObject<plg::vec3>(object)) {
-					auto* const param = params.Get<plg::vec3*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<plg::vec3>;
 			case ValueType::Vector4:
-				if (auto value = ValueFromObject<plg::vec4>(object)) {
-					auto* const param = params.Get<plg::vec4*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<plg::vec4>;
 			case ValueType::Matrix4x4:
-				if (auto value = ValueFromObject<plg::mat4x4>(object)) {
-					auto* const param = params.Get<plg::mat4x4*>(index);
-					*param = *value;
-					return true;
-				}
-				break;
+				return &SetRefParamValue<plg::mat4x4>;
 			default: {
 				const std::string error(std::format(LOG_PREFIX "SetRefParam unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
 				g_py3lm.LogFatal(error);
 				std::terminate();
+				return nullptr;
 			}
 			}
-
-			return false;
 		}
 
 		using void_t = void*;
@@ -1306,12 +1448,11 @@ namespace py3lm {
 			if (value == char16_t{ 0 }) {
 				return PyUnicode_FromStringAndSize(nullptr, Py_ssize_t{ 0 });
 			}
-			const auto [rc, out] = ConvertUtf16ToUtf8(value);
-			if (rc == -1) {
+			if (IsSurrogate(value)) {
 				PyErr_SetString(PyExc_ValueError, "Surrogate pair");
 				return nullptr;
 			}
-			return PyUnicode_FromStringAndSize(out.data(), static_cast<Py_ssize_t>(rc));
+			return PyUnicode_FromOrdinal(value);
 		}
 
 		template<>
@@ -1371,17 +1512,17 @@ namespace py3lm {
 
 		template<>
 		PyObject* CreatePyObject(const plg::string& value) {
-			return PyUnicode_FromStringAndSize(value.data(), static_cast<Py_ssize_t>(value.size()));
+			return PyUnicode_FromStringView(value);
 		}
 
 		template<>
 		PyObject* CreatePyObject(const std::string& value) {
-			return PyUnicode_FromStringAndSize(value.data(), static_cast<Py_ssize_t>(value.size()));
+			return PyUnicode_FromStringView(value);
 		}
 
 		template<>
 		PyObject* CreatePyObject(const std::string_view& value) {
-			return PyUnicode_FromStringAndSize(value.data(), static_cast<Py_ssize_t>(value.size()));
+			return PyUnicode_FromStringView(value);
 		}
 
 #if PY3LM_PLATFORM_WINDOWS
@@ -1458,8 +1599,40 @@ namespace py3lm {
 			return output;
 		}
 
+		// Builds one str from the whole UCS-2 buffer and splits it into one-character strings in C,
+		// latin-1 characters come from the interpreter cache. \0 stays an empty str like CreatePyObject
+		PyObject* CreateChar16List(const plg::vector<char16_t>& arrayArg) {
+			if (HasSurrogates(arrayArg.data(), arrayArg.size())) {
+				PyErr_SetString(PyExc_ValueError, "Surrogate pair");
+				return nullptr;
+			}
+			const auto size = static_cast<Py_ssize_t>(arrayArg.size());
+			PyObject* const unicodeObject = PyUnicode_FromKindAndData(PyUnicode_2BYTE_KIND, arrayArg.data(), size);
+			if (!unicodeObject) {
+				return nullptr;
+			}
+			PyObject* const arrayObject = PySequence_List(unicodeObject);
+			Py_DECREF(unicodeObject);
+			if (!arrayObject) {
+				return nullptr;
+			}
+			for (Py_ssize_t i = 0; i < size; ++i) {
+				if (arrayArg[static_cast<size_t>(i)] == char16_t{ 0 }) {
+					PyObject* const emptyObject = PyUnicode_FromStringAndSize(nullptr, Py_ssize_t{ 0 });
+					if (!emptyObject || PyList_SetItem(arrayObject, i, emptyObject) != 0) {
+						Py_DECREF(arrayObject);
+						return nullptr;
+					}
+				}
+			}
+			return arrayObject;
+		}
+
 		template<typename T>
 		PyObject* CreatePyObjectList(const plg::vector<T>& arrayArg) {
+			if constexpr (std::is_same_v<T, char16_t>) {
+				return CreateChar16List(arrayArg);
+			}
 			const auto size = static_cast<Py_ssize_t>(arrayArg.size());
 			PyObject* const arrayObject = PyList_New(size);
 			if (arrayObject) {
@@ -1585,90 +1758,111 @@ namespace py3lm {
 			}
 		}
 
-		PyObject* ParamToObject(const Property& paramType, const ParametersSpan& params, size_t index) {
-			switch (paramType.GetType()) {
-			case ValueType::Bool:
-				return CreatePyObject(params.Get<bool>(index));
-			case ValueType::Char8:
-				return CreatePyObject(params.Get<char>(index));
-			case ValueType::Char16:
-				return CreatePyObject(params.Get<char16_t>(index));
+		using ParamConvertionFunc = InternalCallPlan::ParamConvertionFunc;
+
+		template<typename T>
+		PyObject* ValueParamToObject([[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			return CreatePyObject(params.Get<T>(index));
+		}
+
+		template<typename T>
+		PyObject* RefParamToObject([[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			return CreatePyObject(*(params.Get<const T*>(index)));
+		}
+
+		template<typename T>
+		PyObject* ArrayParamToObject([[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			return CreatePyObjectList(*(params.Get<const plg::vector<T>*>(index)));
+		}
+
+		PyObject* FunctionParamToObject(const Property& paramType, const ParametersSpan& params, size_t index) {
+			return GetOrCreateFunctionObject(*paramType.GetPrototype(), params.Get<void*>(index));
+		}
+
+		ParamConvertionFunc GetParamToObjectFunc(const Property& paramType) {
+			switch (paramType.GetType()) {
+			case ValueType::Bool:
+				return &ValueParamToObject<bool>;
+			case ValueType::Char8:
+				return &ValueParamToObject<char>;
+			case ValueType::Char16:
+				return &ValueParamToObject<char16_t>;
 			case ValueType::Int8:
-				return CreatePyObject(params.Get<int8_t>(index));
+				return &ValueParamToObject<int8_t>;
 			case ValueType::Int16:
-				return CreatePyObject(params.Get<int16_t>(index));
+				return &ValueParamToObject<int16_t>;
 			case ValueType::Int32:
-				return CreatePyObject(params.Get<int32_t>(index));
+				return &ValueParamToObject<int32_t>;
 			case ValueType::Int64:
-				return CreatePyObject(params.Get<int64_t>(index));
+				return &ValueParamToObject<int64_t>;
 			case ValueType::UInt8:
-				return CreatePyObject(params.Get<uint8_t>(index));
+				return &ValueParamToObject<uint8_t>;
 			case ValueType::UInt16:
-				return CreatePyObject(params.Get<uint16_t>(index));
+				return &ValueParamToObject<uint16_t>;
 			case ValueType::UInt32:
-				return CreatePyObject(params.Get<uint32_t>(index));
+				return &ValueParamToObject<uint32_t>;
 			case ValueType::UInt64:
-				return CreatePyObject(params.Get<uint64_t>(index));
+				return &ValueParamToObject<uint64_t>;
 			case ValueType::Pointer:
-				return CreatePyObject(params.Get<void*>(index));
+				return &ValueParamToObject<void*>;
 			case ValueType::Float:
-				return CreatePyObject(params.Get<float>(index));
+				return &ValueParamToObject<float>;
 			case ValueType::Double:
-				return CreatePyObject(params.Get<double>(index));
+				return &ValueParamToObject<double>;
 			case ValueType::Function:
-				return GetOrCreateFunctionObject(*paramType.GetPrototype(), params.Get<void*>(index));
+				return &FunctionParamToObject;
 			case ValueType::String:
-				return CreatePyObject(*(params.Get<const plg::string*>(index)));
+				return &RefParamToObject<plg::string>;
 			case ValueType::Any:
-				return CreatePyObject(*(params.Get<const plg::any*>(index)));
+				return &RefParamToObject<plg::any>;
 			case ValueType::ArrayBool:
-				return CreatePyObjectList(*(params.Get<const plg::vector<bool>*>(index)));
+				return &ArrayParamToObject<bool>;
 			case ValueType::ArrayChar8:
-				return CreatePyObjectList(*(params.Get<const plg::vector<char>*>(index)));
+				return &ArrayParamToObject<char>;
 			case ValueType::ArrayChar16:
-				return CreatePyObjectList(*(params.Get<const plg::vector<char16_t>*>(index)));
+				return &ArrayParamToObject<char16_t>;
 			case ValueType::ArrayInt8:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int8_t>*>(index)));
+				return &ArrayParamToObject<int8_t>;
 			case ValueType::ArrayInt16:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int16_t>*>(index)));
+				return &ArrayParamToObject<int16_t>;
 			case ValueType::ArrayInt32:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int32_t>*>(index)));
+				return &ArrayParamToObject<int32_t>;
 			case ValueType::ArrayInt64:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int64_t>*>(index)));
+				return &ArrayParamToObject<int64_t>;
 			case ValueType::ArrayUInt8:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint8_t>*>(index)));
+				return &ArrayParamToObject<uint8_t>;
 			case ValueType::ArrayUInt16:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint16_t>*>(index)));
+				return &ArrayParamToObject<uint16_t>;
 			case ValueType::ArrayUInt32:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint32_t>*>(index)));
+				return &ArrayParamToObject<uint32_t>;
 			case ValueType::ArrayUInt64:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint64_t>*>(index)));
+				return &ArrayParamToObject<uint64_t>;
 			case ValueType::ArrayPointer:
-				return CreatePyObjectList(*(params.Get<const plg::vector<void*>*>(index)));
+				return &ArrayParamToObject<void*>;
 			case ValueType::ArrayFloat:
-				return CreatePyObjectList(*(params.Get<const plg::vector<float>*>(index)));
+				return &ArrayParamToObject<float>;
 			case ValueType::ArrayDouble:
-				return CreatePyObjectList(*(params.Get<const plg::vector<double>*>(index)));
+				return &ArrayParamToObject<double>;
 			case ValueType::ArrayString:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::string>*>(index)));
+				return &ArrayParamToObject<plg::string>;
 			case ValueType::ArrayAny:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::any>*>(index)));
+				return &ArrayParamToObject<plg::any>;
 			case ValueType::ArrayVector2:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::vec2>*>(index)));
+				return &ArrayParamToObject<plg::vec2>;
 			case ValueType::ArrayVector3:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::vec3>*>(index)));
+				return &ArrayParamToObject<plg::vec3>;
 			case ValueType::ArrayVector4:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::vec4>*>(index)));
+				return &ArrayParamToObject<plg::vec4>;
 			case ValueType::ArrayMatrix4x4:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::mat4x4>*>(index)));
+				return &ArrayParamToObject<plg::mat4x4>;
 			case ValueType::Vector2:
-				return CreatePyObject(*(params.Get<plg::vec2*>(index)));
+				return &RefParamToObject<plg::vec2>;
 			case ValueType::Vector3:
-				return CreatePyObject(*(params.Get<plg::vec3*>(index)));
+				return &RefParamToObject<plg::vec3>;
 			case ValueType::Vector4:
-				return CreatePyObject(*(params.Get<plg::vec4*>(index)));
+				return &RefParamToObject<plg::vec4>;
 			case ValueType::Matrix4x4:
-				return CreatePyObject(*(params.Get<plg::mat4x4*>(index)));
+				return &RefParamToObject<plg::mat4x4>;
 			default: {
 				const std::string error(std::format(LOG_PREFIX "ParamToObject unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
 				g_py3lm.LogFatal(error);
@@ -1678,88 +1872,88 @@ namespace py3lm {
 			}
 		}
 
-		PyObject* ParamRefToObject(const Property& paramType, const ParametersSpan& params, size_t index) {
+		ParamConvertionFunc GetParamRefToObjectFunc(const Property& paramType) {
 			switch (paramType.GetType()) {
 			case ValueType::Bool:
-				return CreatePyObject(*(params.Get<bool*>(index)));
+				return &RefParamToObject<bool>;
 			case ValueType::Char8:
-				return CreatePyObject(*(params.Get<char*>(index)));
+				return &RefParamToObject<char>;
 			case ValueType::Char16:
-				return CreatePyObject(*(params.Get<char16_t*>(index)));
+				return &RefParamToObject<char16_t>;
 			case ValueType::Int8:
-				return CreatePyObject(*(params.Get<int8_t*>(index)));
+				return &RefParamToObject<int8_t>;
 			case ValueType::Int16:
-				return CreatePyObject(*(params.Get<int16_t*>(index)));
+				return &RefParamToObject<int16_t>;
 			case ValueType::Int32:
-				return CreatePyObject(*(params.Get<int32_t*>(index)));
+				return &RefParamToObject<int32_t>;
 			case ValueType::Int64:
-				return CreatePyObject(*(params.Get<int64_t*>(index)));
+				return &RefParamToObject<int64_t>;
 			case ValueType::UInt8:
-				return CreatePyObject(*(params.Get<uint8_t*>(index)));
+				return &RefParamToObject<uint8_t>;
 			case ValueType::UInt16:
-				return CreatePyObject(*(params.Get<uint16_t*>(index)));
+				return &RefParamToObject<uint16_t>;
 			case ValueType::UInt32:
-				return CreatePyObject(*(params.Get<uint32_t*>(index)));
+				return &RefParamToObject<uint32_t>;
 			case ValueType::UInt64:
-				return CreatePyObject(*(params.Get<uint64_t*>(index)));
+				return &RefParamToObject<uint64_t>;
 			case ValueType::Pointer:
-				return CreatePyObject(*(params.Get<void**>(index)));
+				return &RefParamToObject<void*>;
 			case ValueType::Float:
-				return CreatePyObject(*(params.Get<float*>(index)));
+				return &RefParamToObject<float>;
 			case ValueType::Double:
-				return CreatePyObject(*(params.Get<double*>(index)));
+				return &RefParamToObject<double>;
 			case ValueType::String:
-				return CreatePyObject(*(params.Get<const plg::string*>(index)));
+				return &RefParamToObject<plg::string>;
 			case ValueType::Any:
-				return CreatePyObject(*(params.Get<const plg::any*>(index)));
+				return &RefParamToObject<plg::any>;
 			case ValueType::ArrayBool:
-				return CreatePyObjectList(*(params.Get<const plg::vector<bool>*>(index)));
+				return &ArrayParamToObject<bool>;
 			case ValueType::ArrayChar8:
-				return CreatePyObjectList(*(params.Get<const plg::vector<char>*>(index)));
+				return &ArrayParamToObject<char>;
 			case ValueType::ArrayChar16:
-				return CreatePyObjectList(*(params.Get<const plg::vector<char16_t>*>(index)));
+				return &ArrayParamToObject<char16_t>;
 			case ValueType::ArrayInt8:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int8_t>*>(index)));
+				return &ArrayParamToObject<int8_t>;
 			case ValueType::ArrayInt16:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int16_t>*>(index)));
+				return &ArrayParamToObject<int16_t>;
 			case ValueType::ArrayInt32:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int32_t>*>(index)));
+				return &ArrayParamToObject<int32_t>;
 			case ValueType::ArrayInt64:
-				return CreatePyObjectList(*(params.Get<const plg::vector<int64_t>*>(index)));
+				return &ArrayParamToObject<int64_t>;
 			case ValueType::ArrayUInt8:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint8_t>*>(index)));
+				return &ArrayParamToObject<uint8_t>;
 			case ValueType::ArrayUInt16:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint16_t>*>(index)));
+				return &ArrayParamToObject<uint16_t>;
 			case ValueType::ArrayUInt32:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint32_t>*>(index)));
+				return &ArrayParamToObject<uint32_t>;
 			case ValueType::ArrayUInt64:
-				return CreatePyObjectList(*(params.Get<const plg::vector<uint64_t>*>(index)));
+				return &ArrayParamToObject<uint64_t>;
 			case ValueType::ArrayPointer:
-				return CreatePyObjectList(*(params.Get<const plg::vector<void*>*>(index)));
+				return &ArrayParamToObject<void*>;
 			case ValueType::ArrayFloat:
-				return CreatePyObjectList(*(params.Get<const plg::vector<float>*>(index)));
+				return &ArrayParamToObject<float>;
 			case ValueType::ArrayDouble:
-				return CreatePyObjectList(*(params.Get<const plg::vector<double>*>(index)));
+				return &ArrayParamToObject<double>;
 			case ValueType::ArrayString:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::string>*>(index)));
+				return &ArrayParamToObject<plg::string>;
 			case ValueType::ArrayAny:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::any>*>(index)));
+				return &ArrayParamToObject<plg::any>;
 			case ValueType::ArrayVector2:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::vec2>*>(index)));
+				return &ArrayParamToObject<plg::vec2>;
 			case ValueType::ArrayVector3:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::vec3>*>(index)));
+				return &ArrayParamToObject<plg::vec3>;
 			case ValueType::ArrayVector4:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::vec4>*>(index)));
+				return &ArrayParamToObject<plg::vec4>;
 			case ValueType::ArrayMatrix4x4:
-				return CreatePyObjectList(*(params.Get<const plg::vector<plg::mat4x4>*>(index)));
+				return &ArrayParamToObject<plg::mat4x4>;
 			case ValueType::Vector2:
-				return CreatePyObject(*(params.Get<plg::vec2*>(index)));
+				return &RefParamToObject<plg::vec2>;
 			case ValueType::Vector3:
-				return CreatePyObject(*(params.Get<plg::vec3*>(index)));
+				return &RefParamToObject<plg::vec3>;
 			case ValueType::Vector4:
-				return CreatePyObject(*(params.Get<plg::vec4*>(index)));
+				return &RefParamToObject<plg::vec4>;
 			case ValueType::Matrix4x4:
-				return CreatePyObject(*(params.Get<plg::mat4x4*>(index)));
+				return &RefParamToObject<plg::mat4x4>;
 			default: {
 				const std::string error(std::format(LOG_PREFIX "ParamRefToObject unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
 				g_py3lm.LogFatal(error);
@@ -1769,29 +1963,194 @@ namespace py3lm {
 			}
 		}
 
+		template<typename T>
+		PyObject* CreateArrayViewObject(const plg::vector<T>& array);
+
+		template<typename T>
+		PyObject* CreateArrayViewObject(plg::vector<T>* array);
+
+		void ReleaseArrayViews(PyObject* const* args, size_t count);
+
+		template<typename T>
+		PyObject* ArrayParamToArrayViewObject([[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			return CreateArrayViewObject(*(params.Get<const plg::vector<T>*>(index)));
+		}
+
+		template<typename T>
+		PyObject* ArrayRefParamToArrayViewObject([[maybe_unused]] const Property& paramType, const ParametersSpan& params, size_t index) {
+			return CreateArrayViewObject(params.Get<plg::vector<T>*>(index));
+		}
+
+		ParamConvertionFunc GetParamToArrayViewObjectFunc(const Property& paramType) {
+			switch (paramType.GetType()) {
+			case ValueType::ArrayInt8:
+				return &ArrayParamToArrayViewObject<int8_t>;
+			case ValueType::ArrayInt16:
+				return &ArrayParamToArrayViewObject<int16_t>;
+			case ValueType::ArrayInt32:
+				return &ArrayParamToArrayViewObject<int32_t>;
+			case ValueType::ArrayInt64:
+				return &ArrayParamToArrayViewObject<int64_t>;
+			case ValueType::ArrayUInt8:
+				return &ArrayParamToArrayViewObject<uint8_t>;
+			case ValueType::ArrayUInt16:
+				return &ArrayParamToArrayViewObject<uint16_t>;
+			case ValueType::ArrayUInt32:
+				return &ArrayParamToArrayViewObject<uint32_t>;
+			case ValueType::ArrayUInt64:
+				return &ArrayParamToArrayViewObject<uint64_t>;
+			case ValueType::ArrayPointer:
+				return &ArrayParamToArrayViewObject<void*>;
+			case ValueType::ArrayFloat:
+				return &ArrayParamToArrayViewObject<float>;
+			case ValueType::ArrayDouble:
+				return &ArrayParamToArrayViewObject<double>;
+			case ValueType::ArrayVector2:
+				return &ArrayParamToArrayViewObject<plg::vec2>;
+			case ValueType::ArrayVector3:
+				return &ArrayParamToArrayViewObject<plg::vec3>;
+			case ValueType::ArrayVector4:
+				return &ArrayParamToArrayViewObject<plg::vec4>;
+			case ValueType::ArrayMatrix4x4:
+				return &ArrayParamToArrayViewObject<plg::mat4x4>;
+			default:
+				// bool, char and string arrays are still passed as lists
+				return GetParamToObjectFunc(paramType);
+			}
+		}
+
+		ParamConvertionFunc GetParamRefToArrayViewObjectFunc(const Property& paramType) {
+			switch (paramType.GetType()) {
+			case ValueType::ArrayInt8:
+				return &ArrayRefParamToArrayViewObject<int8_t>;
+			case ValueType::ArrayInt16:
+				return &ArrayRefParamToArrayViewObject<int16_t>;
+			case ValueType::ArrayInt32:
+				return &ArrayRefParamToArrayViewObject<int32_t>;
+			case ValueType::ArrayInt64:
+				return &ArrayRefParamToArrayViewObject<int64_t>;
+			case ValueType::ArrayUInt8:
+				return &ArrayRefParamToArrayViewObject<uint8_t>;
+			case ValueType::ArrayUInt16:
+				return &ArrayRefParamToArrayViewObject<uint16_t>;
+			case ValueType::ArrayUInt32:
+				return &ArrayRefParamToArrayViewObject<uint32_t>;
+			case ValueType::ArrayUInt64:
+				return &ArrayRefParamToArrayViewObject<uint64_t>;
+			case ValueType::ArrayPointer:
+				return &ArrayRefParamToArrayViewObject<void*>;
+			case ValueType::ArrayFloat:
+				return &ArrayRefParamToArrayViewObject<float>;
+			case ValueType::ArrayDouble:
+				return &ArrayRefParamToArrayViewObject<double>;
+			case ValueType::ArrayVector2:
+				return &ArrayRefParamToArrayViewObject<plg::vec2>;
+			case ValueType::ArrayVector3:
+				return &ArrayRefParamToArrayViewObject<plg::vec3>;
+			case ValueType::ArrayVector4:
+				return &ArrayRefParamToArrayViewObject<plg::vec4>;
+			case ValueType::ArrayMatrix4x4:
+				return &ArrayRefParamToArrayViewObject<plg::mat4x4>;
+			default:
+				return GetParamRefToObjectFunc(paramType);
+			}
+		}
+
+		// Attaches the calling thread to an interpreter for the scope. With per-plugin interpreters only one GIL
+		// is held at a time, so the interpreter the thread is in is left until the scope ends and then re-entered.
 		struct GILLock {
-			GILLock() {
+			explicit GILLock([[maybe_unused]] InterpreterState& state) {
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+#if PY_VERSION_HEX >= 0x030D0000
+				PyThreadState* const current = PyThreadState_GetUnchecked();
+#else
+				PyThreadState* const current = _PyThreadState_UncheckedGet();
+#endif
+				if (current && PyThreadState_GetInterpreter(current) == state.interpreter) {
+					return;
+				}
+				if (current) {
+					_previous = PyEval_SaveThread();
+				}
+				PyEval_RestoreThread(g_py3lm.GetThreadState(state));
+				_attached = true;
+#else
 				_state = PyGILState_Ensure();
+#endif
 			}
 
 			~GILLock() {
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+				if (_attached) {
+					PyEval_SaveThread();
+					if (_previous) {
+						PyEval_RestoreThread(_previous);
+					}
+				}
+#else
 				PyGILState_Release(_state);
+#endif
 			}
 
+			GILLock(const GILLock&) = delete;
+			GILLock& operator=(const GILLock&) = delete;
+
 		private:
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+			PyThreadState* _previous{};
+			bool _attached{};
+#else
 			PyGILState_STATE _state;
+#endif
+		};
+
+		// Owned arguments of a vectorcall into python. Slot 0 is left free for PY_VECTORCALL_ARGUMENTS_OFFSET,
+		// so bound methods can prepend self without copying. Common arities stay on the stack.
+		class VectorcallArgs {
+		public:
+			VectorcallArgs(size_t capacity, bool arrayViews) : _arrayViews(arrayViews) {
+				if (capacity + 1 > _inline.size()) {
+					_heap.resize(capacity + 1);
+					_data = _heap.data();
+				} else {
+					_data = _inline.data();
+				}
+			}
+
+			// Views borrow the caller's vectors, which do not outlive InternalCall
+			~VectorcallArgs() {
+				if (_arrayViews) {
+					ReleaseArrayViews(Args(), _size);
+				}
+				for (size_t i = 0; i < _size; ++i) {
+					Py_DECREF(Args()[i]);
+				}
+			}
+
+			VectorcallArgs(const VectorcallArgs&) = delete;
+			VectorcallArgs& operator=(const VectorcallArgs&) = delete;
+
+			void Push(PyObject* arg) { _data[1 + _size++] = arg; }
+			PyObject* const* Args() const { return _data + 1; }
+			size_t Size() const { return _size; }
+
+		private:
+			std::array<PyObject*, 9> _inline{};
+			std::vector<PyObject*> _heap;
+			PyObject** _data;
+			size_t _size{};
+			bool _arrayViews;
 		};
 
 		void InternalCall(const Method* method, MemAddr data, uint64_t* parameters, const size_t count, void* return_) {
-			GILLock lock{};
+			const InternalCallPlan& plan = *data.RCast<const InternalCallPlan*>();
 
+			GILLock lock(*plan.state);
 			const Property& retType = method->GetRetType();
 
 			ParametersSpan params(parameters, count);
 			ReturnSlot ret(return_, ValueUtils::SizeOf(retType.GetType()));
 
-			PyObject* const func = data.RCast<PyObject*>();
-
 			enum class ParamProcess {
 				NoError,
 				Error,
@@ -1800,48 +2159,37 @@ namespace py3lm {
 			ParamProcess processResult = ParamProcess::NoError;
 
 			const auto& paramTypes = method->GetParamTypes();
-			size_t paramsCount = paramTypes.size();
-			size_t refParamsCount = 0;
-
-			PyObject* argTuple = nullptr;
-			if (paramsCount) {
-				argTuple = PyTuple_New(static_cast<Py_ssize_t>(paramsCount));
-				if (!argTuple) {
-					processResult = ParamProcess::ErrorWithException;
-					PyErr_SetString(PyExc_RuntimeError, "Fail to create arguments tuple");
-				}
-				else {
-					for (size_t index = 0; index < paramsCount; ++index) {
-						const Property& paramType = paramTypes[index];
-						if (paramType.IsRef()) {
-							++refParamsCount;
-						}
-						using ParamConvertionFunc = PyObject* (*)(const Property&, const ParametersSpan&, size_t);
-						ParamConvertionFunc const convertFunc = paramType.GetEnumerate() ?
-							(paramType.IsRef() ? &ParamRefToEnumObject : &ParamToEnumObject) :
-							(paramType.IsRef() ? &ParamRefToObject : &ParamToObject);
-						convertFunc(paramType, params, index);
-						PyObject* const arg = convertFunc(paramType, params, index);
-						if (!arg) {
-							// convertFunc may set error
-							processResult = PyErr_Occurred() ? ParamProcess::ErrorWithException : ParamProcess::Error;
-							break;
-						}
-						if (PyTuple_SetItem(argTuple, static_cast<Py_ssize_t>(index), arg) != 0) {
-							Py_DECREF(arg);
-							// PyTuple_SetItem set error
-							processResult = ParamProcess::ErrorWithException;
-							break;
-						}
-						// arg reference "stolen" by tuple set, no need to handle
-					}
+			const size_t paramsCount = plan.paramFuncs.size();
+			const size_t refParamsCount = plan.refParams.size();
+
+			// Kept alive across the call in case it releases its own callback
+			PyObject* func;
+			{
+				ReadLock registryLock(plan.state->registryMutex);
+				func = Py_XNewRef(plan.func);
+			}
+			if (!func) {
+				PyErr_SetString(PyExc_RuntimeError, "Callback was released while still in use by native code");
+				g_py3lm.LogError();
+				SetFallbackReturn(retType.GetType(), ret);
+				return;
+			}
+
+			// Released on return, after ref params are written back
+			VectorcallArgs args(paramsCount, plan.useArrayViews);
+			for (size_t index = 0; index < paramsCount; ++index) {
+				PyObject* const arg = plan.paramFuncs[index](paramTypes[index], params, index);
+				if (!arg) {
+					// Converter may set error
+					processResult = PyErr_Occurred() ? ParamProcess::ErrorWithException : ParamProcess::Error;
+					break;
 				}
+				args.Push(arg);
 			}
 
 			if (processResult != ParamProcess::NoError) {
-				if (argTuple) {
-					Py_DECREF(argTuple);
-				}
+				Py_DECREF(func);
+
 				if (processResult == ParamProcess::ErrorWithException) {
 					g_py3lm.LogError();
 				}
@@ -1851,11 +2199,8 @@ namespace py3lm {
 				return;
 			}
 
-			PyObject* const result = PyObject_CallObject(func, argTuple);
-
-			if (argTuple) {
-				Py_DECREF(argTuple);
-			}
+			PyObject* const result = PyObject_Vectorcall(func, args.Args(), args.Size() | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+			Py_DECREF(func);
 
 			if (!result) {
 				g_py3lm.LogError();
@@ -1877,7 +2222,7 @@ namespace py3lm {
 
 					return;
 				}
-				const Py_ssize_t tupleSize = PyTuple_Size(result);
+				const Py_ssize_t tupleSize = PyTuple_GET_SIZE(result);
 				if (tupleSize != static_cast<Py_ssize_t>(1 + refParamsCount)) {
 					const std::string error(std::format("Returned tuple wrong size {}, expected {}", tupleSize, static_cast<Py_ssize_t>(1 + refParamsCount)));
 					PyErr_SetString(PyExc_TypeError, error.c_str());
@@ -1891,26 +2236,25 @@ namespace py3lm {
 					return;
 				}
 
-				for (size_t index = 0, k = 0; index < paramsCount; ++index) {
-					const Property& paramType = paramTypes[index];
-					if (!paramType.IsRef()) {
+				for (size_t k = 0; k < refParamsCount; ++k) {
+					const auto& [index, setRefParamFunc] = plan.refParams[k];
+					PyObject* const refObject = PyTuple_GET_ITEM(result, static_cast<Py_ssize_t>(1 + k));
+					// Writable view given back as is, its changes are already in the caller's vector
+					if (plan.useArrayViews && refObject == args.Args()[index] && IsArrayViewObject(refObject)) {
 						continue;
 					}
-					if (!SetRefParam(PyTuple_GET_ITEM(result, static_cast<Py_ssize_t>(1 + k)), paramType, params, index)) {
-						// SetRefParam may set error
+					if (!setRefParamFunc(refObject, paramTypes[index], params, index)) {
+						// setRefParamFunc may set error
 						if (PyErr_Occurred()) {
 							g_py3lm.LogError();
 						}
 					}
-					if (++k == refParamsCount) {
-						break;
-					}
 				}
 			}
 
 			PyObject* const returnObject = refParamsCount != 0 ? PyTuple_GET_ITEM(result, Py_ssize_t{ 0 }) : result;
 
-			if (!SetReturn(returnObject, retType, ret)) {
+			if (!plan.setReturnFunc(returnObject, retType, ret)) {
 				if (PyErr_Occurred()) {
 					g_py3lm.LogError();
 				}
@@ -1921,12 +2265,55 @@ namespace py3lm {
 			Py_DECREF(result);
 		}
 
-		std::pair<bool, JitCallback> CreateInternalCall(const Method& method, PyObject* func) {
+		ParamConvertionFunc GetInternalParamFunc(const Property& paramType, bool useArrayViews) {
+			if (paramType.GetEnumerate()) {
+				return paramType.IsRef() ? &ParamRefToEnumObject : &ParamToEnumObject;
+			}
+			if (useArrayViews) {
+				return paramType.IsRef() ? GetParamRefToArrayViewObjectFunc(paramType) : GetParamToArrayViewObjectFunc(paramType);
+			}
+			return paramType.IsRef() ? GetParamRefToObjectFunc(paramType) : GetParamToObjectFunc(paramType);
+		}
+
+		std::unique_ptr<InternalCallPlan> CreateInternalCallPlan(const Method& method, PyObject* func, bool useArrayViews) {
+			auto plan = std::make_unique<InternalCallPlan>();
+			plan->func = func;
+			plan->state = &g_py3lm.GetState();
+			plan->useArrayViews = useArrayViews;
+			plan->setReturnFunc = GetSetReturnFunc(method.GetRetType());
+
+			const auto& paramTypes = method.GetParamTypes();
+			plan->paramFuncs.reserve(paramTypes.size());
+			for (size_t index = 0; index < paramTypes.size(); ++index) {
+				const Property& paramType = paramTypes[index];
+				plan->paramFuncs.push_back(GetInternalParamFunc(paramType, useArrayViews));
+				if (paramType.IsRef()) {
+					plan->refParams.push_back({ index, GetSetRefParamFunc(paramType) });
+				}
+			}
+			return plan;
+		}
+
+		std::pair<bool, JitCallback> CreateInternalCall(const Method& method, InternalCallPlan& plan) {
 			JitCallback callback{};
-			void* const methodAddr = callback.GetJitFunc(method, &InternalCall, func);
+			void* const methodAddr = callback.GetJitFunc(method, &InternalCall, &plan);
 			return { methodAddr != nullptr, std::move(callback) };
 		}
 
+		bool HasArrayViewsFlag(PyObject* func) {
+			PyObject* const flag = PyObject_GetAttrString(func, "__plugify_array_views__");
+			if (!flag) {
+				PyErr_Clear();
+				return false;
+			}
+			const int result = PyObject_IsTrue(flag);
+			Py_DECREF(flag);
+			if (result < 0) {
+				PyErr_Clear();
+			}
+			return result == 1;
+		}
+
 		Result<PythonMethodData> GenerateMethodExport(const Method& method, PyObject* pluginDict, PyObject* pluginInstance) {
 			PyObject* func{};
 
@@ -1945,13 +2332,13 @@ namespace py3lm {
 			const bool funcIsMethod = !className.empty();
 
 			if (funcIsMethod) {
-				if (PyObject* const classType = PyDict_GetItemString(pluginDict, className.c_str())) {
+				if (PyObject* const classType = GetDictItemRef(pluginDict, className.c_str())) {
 					func = PyObject_GetAttrString(classType, methodName.c_str());
 					Py_DECREF(classType);
 				}
 			}
 			else {
-				func = PyDict_GetItemString(pluginDict, methodName.c_str());
+				func = GetDictItemRef(pluginDict, methodName.c_str());
 			}
 
 			if (!func) {
@@ -1964,6 +2351,9 @@ namespace py3lm {
 				return MakeError("'{}' not function type", method.GetFuncName());
 			}
 
+			// Opt-in through plugify.plugin.array_views decorator
+			const bool useArrayViews = HasArrayViewsFlag(func);
+
 			if (funcIsMethod && !IsStaticMethod(func)) {
 				PyObject* const bind = PyMethod_New(func, pluginInstance);
 				Py_DECREF(func);
@@ -1973,1026 +2363,976 @@ namespace py3lm {
 				func = bind;
 			}
 
-			auto [result, callback] = CreateInternalCall(method, func);
+			auto plan = CreateInternalCallPlan(method, func, useArrayViews);
+			auto [result, callback] = CreateInternalCall(method, *plan);
 
 			if (!result) {
 				Py_DECREF(func);
 				return MakeError("jit error: {}", callback.GetError());
 			}
 
-			return PythonMethodData{ std::move(callback), func };
+			return PythonMethodData{ std::move(callback), func, std::move(plan) };
 		}
 
-		struct ArgsScope {
-			Parameters params;
-			std::vector<std::pair<void*, ValueType>> storage; // used to store array temp memory
+		// Thread-local bump allocator for call temporaries. Scopes nest strictly on a thread
+		// (python -> c++ -> python -> c++), so each ArgsScope rewinds to the mark it took on entry.
+		// Chunks are kept for reuse, which makes steady state calls free of global allocations.
+		class CallArena {
+		public:
+			struct Mark {
+				size_t chunk;
+				size_t offset;
+			};
 
-			explicit ArgsScope(size_t size) : params(size) {
-				storage.reserve(size);
+			static CallArena& Get() {
+				thread_local CallArena arena;
+				return arena;
 			}
 
-			~ArgsScope() {
-				for (auto& [ptr, type] : storage) {
-					switch (type) {
-					case ValueType::Bool: {
-						delete static_cast<bool*>(ptr);
-						break;
-					}
-					case ValueType::Char8: {
-						delete static_cast<char*>(ptr);
-						break;
-					}
-					case ValueType::Char16: {
-						delete static_cast<char16_t*>(ptr);
-						break;
-					}
-					case ValueType::Int8: {
-						delete static_cast<int8_t*>(ptr);
-						break;
-					}
-					case ValueType::Int16: {
-						delete static_cast<int16_t*>(ptr);
-						break;
-					}
-					case ValueType::Int32: {
-						delete static_cast<int32_t*>(ptr);
-						break;
-					}
-					case ValueType::Int64: {
-						delete static_cast<int64_t*>(ptr);
-						break;
-					}
-					case ValueType::UInt8: {
-						delete static_cast<uint8_t*>(ptr);
-						break;
-					}
-					case ValueType::UInt16: {
-						delete static_cast<uint16_t*>(ptr);
-						break;
-					}
-					case ValueType::UInt32: {
-						delete static_cast<uint32_t*>(ptr);
-						break;
-					}
-					case ValueType::UInt64: {
-						delete static_cast<uint64_t*>(ptr);
-						break;
-					}
-					case ValueType::Pointer: {
-						delete static_cast<void**>(ptr);
-						break;
-					}
-					case ValueType::Float: {
-						delete static_cast<float*>(ptr);
-						break;
-					}
-					case ValueType::Double: {
-						delete static_cast<double*>(ptr);
-						break;
-					}
-					case ValueType::String: {
-						delete static_cast<plg::string*>(ptr);
-						break;
-					}
-					case ValueType::Any: {
-						delete static_cast<plg::any*>(ptr);
-						break;
-					}
-					case ValueType::ArrayBool: {
-						delete static_cast<plg::vector<bool>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayChar8: {
-						delete static_cast<plg::vector<char>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayChar16: {
-						delete static_cast<plg::vector<char16_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayInt8: {
-						delete static_cast<plg::vector<int8_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayInt16: {
-						delete static_cast<plg::vector<int16_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayInt32: {
-						delete static_cast<plg::vector<int32_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayInt64: {
-						delete static_cast<plg::vector<int64_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayUInt8: {
-						delete static_cast<plg::vector<uint8_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayUInt16: {
-						delete static_cast<plg::vector<uint16_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayUInt32: {
-						delete static_cast<plg::vector<uint32_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayUInt64: {
-						delete static_cast<plg::vector<uint64_t>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayPointer: {
-						delete static_cast<plg::vector<void*>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayFloat: {
-						delete static_cast<plg::vector<float>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayDouble: {
-						delete static_cast<plg::vector<double>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayString: {
-						delete static_cast<plg::vector<plg::string>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayAny: {
-						delete static_cast<plg::vector<plg::any>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayVector2: {
-						delete static_cast<plg::vector<plg::vec2>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayVector3: {
-						delete static_cast<plg::vector<plg::vec3>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayVector4: {
-						delete static_cast<plg::vector<plg::vec4>*>(ptr);
-						break;
-					}
-					case ValueType::ArrayMatrix4x4: {
-						delete static_cast<plg::vector<plg::mat4x4>*>(ptr);
-						break;
-					}
-					case ValueType::Vector2: {
-						delete static_cast<plg::vec2*>(ptr);
-						break;
-					}
-					case ValueType::Vector3: {
-						delete static_cast<plg::vec3*>(ptr);
-						break;
-					}
-					case ValueType::Vector4: {
-						delete static_cast<plg::vec4*>(ptr);
-						break;
-					}
-					case ValueType::Matrix4x4: {
-						delete static_cast<plg::mat4x4*>(ptr);
-						break;
-					}
-					default: {
-						const std::string error(std::format(LOG_PREFIX "ArgsScope unhandled type {:#x}", static_cast<uint8_t>(type)));
-						g_py3lm.LogFatal(error);
-						std::terminate();
-						break;
+			Mark GetMark() const { return { _chunk, _offset }; }
+
+			void Rewind(const Mark& mark) {
+				_chunk = mark.chunk;
+				_offset = mark.offset;
+			}
+
+			template<typename T>
+			T* AllocateArray(size_t count) {
+				static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Chunks are only aligned for new");
+				const size_t size = sizeof(T) * count;
+				for (;; ++_chunk, _offset = 0) {
+					if (_chunk == _chunks.size()) {
+						// Oversized requests get a dedicated chunk, which is then reused like any other
+						const size_t chunkSize = std::max(kChunkSize, size);
+						_chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(chunkSize), chunkSize);
 					}
+					Chunk& chunk = _chunks[_chunk];
+					const size_t offset = (_offset + alignof(T) - 1) & ~(alignof(T) - 1);
+					if (offset + size <= chunk.size) {
+						_offset = offset + size;
+						return reinterpret_cast<T*>(chunk.data.get() + offset);
 					}
 				}
 			}
+
+		private:
+			static constexpr size_t kChunkSize = 16 * 1024;
+
+			struct Chunk {
+				std::unique_ptr<std::byte[]> data;
+				size_t size;
+			};
+
+			std::vector<Chunk> _chunks;
+			size_t _chunk{};
+			size_t _offset{};
 		};
 
-		void BeginExternalCall(ValueType retType, ArgsScope& a) {
-			void* value;
-			switch (retType) {
-				case ValueType::String: {
-					value = new plg::string();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::Any: {
-					value = new plg::any();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayBool: {
-					value = new plg::vector<bool>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayChar8: {
-					value = new plg::vector<char>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayChar16: {
-					value = new plg::vector<char16_t>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayInt8: {
-					value = new plg::vector<int8_t>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayInt16: {
-					value = new plg::vector<int16_t>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayInt32: {
-					value = new plg::vector<int32_t>();
-					a.storage.emplace_back(value, retType);
-					break;
+		struct PoolCounters {
+			std::atomic<uint64_t> hits;
+			std::atomic<uint64_t> misses;
+			std::atomic<uint64_t> trimmed;
+		};
+
+		// Per-thread free list of cleared strings or vectors which keep their capacity. Array and string
+		// params are filled into pooled containers, and every container owned by ArgsScope (including
+		// hidden returns constructed by the callee) is handed back here when the call ends.
+		// High-water trimming: entries which stayed idle for a whole window of releases are dropped,
+		// so the pool shrinks back to the peak demand after a burst.
+		template<typename T>
+		class ContainerPool {
+		public:
+			static ContainerPool& Get() {
+				thread_local ContainerPool pool;
+				return pool;
+			}
+
+			// Counters are shared by all threads
+			static PoolCounters& Counters() {
+				static PoolCounters counters;
+				return counters;
+			}
+
+			T Acquire() {
+				if (_free.empty()) {
+					Counters().misses.fetch_add(1, std::memory_order_relaxed);
+					return T();
 				}
-				case ValueType::ArrayInt64: {
-					value = new plg::vector<int64_t>();
-					a.storage.emplace_back(value, retType);
-					break;
+				Counters().hits.fetch_add(1, std::memory_order_relaxed);
+				T value(std::move(_free.back()));
+				_free.pop_back();
+				_lowWater = std::min(_lowWater, _free.size());
+				return value;
+			}
+
+			void Release(T& value) {
+				value.clear();
+				if (value.capacity() != 0 && value.capacity() * sizeof(typename T::value_type) <= kMaxPooledBytes && _free.size() < kMaxPooledCount) {
+					_free.push_back(std::move(value));
 				}
-				case ValueType::ArrayUInt8: {
-					value = new plg::vector<uint8_t>();
-					a.storage.emplace_back(value, retType);
-					break;
+				if (++_releases % kTrimInterval == 0) {
+					Trim();
 				}
-				case ValueType::ArrayUInt16: {
-					value = new plg::vector<uint16_t>();
-					a.storage.emplace_back(value, retType);
-					break;
+			}
+
+		private:
+			static constexpr size_t kMaxPooledCount = 16;
+			static constexpr size_t kMaxPooledBytes = 1024 * 1024;
+			static constexpr size_t kTrimInterval = 256;
+
+			void Trim() {
+				if (_lowWater) {
+					_free.erase(_free.begin(), _free.begin() + static_cast<ptrdiff_t>(_lowWater));
+					Counters().trimmed.fetch_add(_lowWater, std::memory_order_relaxed);
 				}
-				case ValueType::ArrayUInt32: {
-					value = new plg::vector<uint32_t>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayUInt64: {
-					value = new plg::vector<uint64_t>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayPointer: {
-					value = new plg::vector<void*>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayFloat: {
-					value = new plg::vector<float>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayDouble: {
-					value = new plg::vector<double>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayString: {
-					value = new plg::vector<plg::string>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayAny: {
-					value = new plg::vector<plg::any>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayVector2: {
-					value = new plg::vector<plg::vec2>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayVector3: {
-					value = new plg::vector<plg::vec3>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayVector4: {
-					value = new plg::vector<plg::vec4>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::ArrayMatrix4x4: {
-					value = new plg::vector<plg::mat4x4>();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::Vector2: {
-					value = new plg::vec2();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::Vector3: {
-					value = new plg::vec3();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::Vector4: {
-					value = new plg::vec4();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				case ValueType::Matrix4x4: {
-					value = new plg::mat4x4();
-					a.storage.emplace_back(value, retType);
-					break;
-				}
-				default:
-					const std::string error(std::format(LOG_PREFIX "BeginExternalCall unsupported type {:#x}", static_cast<uint8_t>(retType)));
-					g_py3lm.LogFatal(error);
-					std::terminate();
-					break;
+				_lowWater = _free.size();
 			}
 
-			a.params.Add(value);
-		}
+			std::vector<T> _free;
+			size_t _lowWater{};
+			size_t _releases{};
+		};
 
-		PyObject* MakeExternalCallWithEnumObject(const Property& retType, JitCall::CallingFunc func, const ArgsScope& a, Return& ret) {
-			func(a.params.Get(), &ret);
-			const auto& enumerator = *retType.GetEnumerate();
-			switch (retType.GetType()) {
-			case ValueType::Int8: {
-				const int8_t val = ret.Get<int8_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::Int16: {
-				const int16_t val = ret.Get<int16_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::Int32: {
-				const int32_t val = ret.Get<int32_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::Int64: {
-				const int64_t val = ret.Get<int64_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::UInt8: {
-				const uint8_t val = ret.Get<uint8_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::UInt16: {
-				const uint16_t val = ret.Get<uint16_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::UInt32: {
-				const uint32_t val = ret.Get<uint32_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::UInt64: {
-				const uint64_t val = ret.Get<uint64_t>();
-				return CreatePyEnumObject(enumerator, val);
-			}
-			case ValueType::ArrayInt8: {
-				auto* const arr = ret.Get<plg::vector<int8_t>*>();
-				return CreatePyEnumObjectList<int8_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayInt16: {
-				auto* const arr = ret.Get<plg::vector<int16_t>*>();
-				return CreatePyEnumObjectList<int16_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayInt32: {
-				auto* const arr = ret.Get<plg::vector<int32_t>*>();
-				return CreatePyEnumObjectList<int32_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayInt64: {
-				auto* const arr = ret.Get<plg::vector<int64_t>*>();
-				return CreatePyEnumObjectList<int64_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayUInt8: {
-				auto* const arr = ret.Get<plg::vector<uint8_t>*>();
-				return CreatePyEnumObjectList<uint8_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayUInt16: {
-				auto* const arr = ret.Get<plg::vector<uint16_t>*>();
-				return CreatePyEnumObjectList<uint16_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayUInt32: {
-				auto* const arr = ret.Get<plg::vector<uint32_t>*>();
-				return CreatePyEnumObjectList<uint32_t>(enumerator, *arr);
-			}
-			case ValueType::ArrayUInt64: {
-				auto* const arr = ret.Get<plg::vector<uint64_t>*>();
-				return CreatePyEnumObjectList<uint64_t>(enumerator, *arr);
-			}
-			default: {
-				const std::string error(std::format("MakeExternalCallWithEnumObject unsupported enum type {:#x}", static_cast<uint8_t>(retType.GetType())));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
-				return nullptr;
-			}
-			}
-		}
+		// Arity of most exports, plus the hidden return param
+		constexpr size_t kInlineArgsCount = 9;
 
-		PyObject* MakeExternalCallWithObject(const Property& retType, JitCall::CallingFunc func, const ArgsScope& a, Return& ret) {
-			func(a.params.Get(), &ret);
-			switch (retType.GetType()) {
-			case ValueType::Void:
-				Py_RETURN_NONE;
-			case ValueType::Bool: {
-				const bool val = ret.Get<bool>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Char8: {
-				const char val = ret.Get<char>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Char16: {
-				const char16_t val = ret.Get<char16_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Int8: {
-				const int8_t val = ret.Get<int8_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Int16: {
-				const int16_t val = ret.Get<int16_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Int32: {
-				const int32_t val = ret.Get<int32_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Int64: {
-				const int64_t val = ret.Get<int64_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::UInt8: {
-				const uint8_t val = ret.Get<uint8_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::UInt16: {
-				const uint16_t val = ret.Get<uint16_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::UInt32: {
-				const uint32_t val = ret.Get<uint32_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::UInt64: {
-				const uint64_t val = ret.Get<uint64_t>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Pointer: {
-				void* val = ret.Get<void*>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Float: {
-				const float val = ret.Get<float>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Double: {
-				const double val = ret.Get<double>();
-				return CreatePyObject(val);
-			}
-			case ValueType::Function: {
-				void* const val = ret.Get<void*>();
-				return GetOrCreateFunctionObject(*retType.GetPrototype(), val);
-			}
-			case ValueType::String: {
-				auto* const str = ret.Get<plg::string*>();
-				return CreatePyObject(*str);
-			}
-			case ValueType::Any: {
-				auto* const str = ret.Get<plg::any*>();
-				return CreatePyObject(*str);
-			}
-			case ValueType::ArrayBool: {
-				auto* const arr = ret.Get<plg::vector<bool>*>();
-				return CreatePyObjectList<bool>(*arr);
-			}
-			case ValueType::ArrayChar8: {
-				auto* const arr = ret.Get<plg::vector<char>*>();
-				return CreatePyObjectList<char>(*arr);
-			}
-			case ValueType::ArrayChar16: {
-				auto* const arr = ret.Get<plg::vector<char16_t>*>();
-				return CreatePyObjectList<char16_t>(*arr);
-			}
-			case ValueType::ArrayInt8: {
-				auto* const arr = ret.Get<plg::vector<int8_t>*>();
-				return CreatePyObjectList<int8_t>(*arr);
-			}
-			case ValueType::ArrayInt16: {
-				auto* const arr = ret.Get<plg::vector<int16_t>*>();
-				return CreatePyObjectList<int16_t>(*arr);
-			}
-			case ValueType::ArrayInt32: {
-				auto* const arr = ret.Get<plg::vector<int32_t>*>();
-				return CreatePyObjectList<int32_t>(*arr);
-			}
-			case ValueType::ArrayInt64: {
-				auto* const arr = ret.Get<plg::vector<int64_t>*>();
-				return CreatePyObjectList<int64_t>(*arr);
-			}
-			case ValueType::ArrayUInt8: {
-				auto* const arr = ret.Get<plg::vector<uint8_t>*>();
-				return CreatePyObjectList<uint8_t>(*arr);
-			}
-			case ValueType::ArrayUInt16: {
-				auto* const arr = ret.Get<plg::vector<uint16_t>*>();
-				return CreatePyObjectList<uint16_t>(*arr);
-			}
-			case ValueType::ArrayUInt32: {
-				auto* const arr = ret.Get<plg::vector<uint32_t>*>();
-				return CreatePyObjectList<uint32_t>(*arr);
-			}
-			case ValueType::ArrayUInt64: {
-				auto* const arr = ret.Get<plg::vector<uint64_t>*>();
-				return CreatePyObjectList<uint64_t>(*arr);
-			}
-			case ValueType::ArrayPointer: {
-				auto* const arr = ret.Get<plg::vector<void*>*>();
-				return CreatePyObjectList<void*>(*arr);
-			}
-			case ValueType::ArrayFloat: {
-				auto* const arr = ret.Get<plg::vector<float>*>();
-				return CreatePyObjectList<float>(*arr);
-			}
-			case ValueType::ArrayDouble: {
-				auto* const arr = ret.Get<plg::vector<double>*>();
-				return CreatePyObjectList<double>(*arr);
-			}
-			case ValueType::ArrayString: {
-				auto* const arr = ret.Get<plg::vector<plg::string>*>();
-				return CreatePyObjectList<plg::string>(*arr);
-			}
-			case ValueType::ArrayAny: {
-				auto* const arr = ret.Get<plg::vector<plg::any>*>();
-				return CreatePyObjectList<plg::any>(*arr);
-			}
-			case ValueType::ArrayVector2: {
-				auto* const arr = ret.Get<plg::vector<plg::vec2>*>();
-				return CreatePyObjectList<plg::vec2>(*arr);
-			}
-			case ValueType::ArrayVector3: {
-				auto* const arr = ret.Get<plg::vector<plg::vec3>*>();
-				return CreatePyObjectList<plg::vec3>(*arr);
-			}
-			case ValueType::ArrayVector4: {
-				auto* const arr = ret.Get<plg::vector<plg::vec4>*>();
-				return CreatePyObjectList<plg::vec4>(*arr);
+		// Fixed capacity list which keeps the common arity inline and spills to the arena otherwise
+		template<typename T>
+		class ArgsList {
+		public:
+			ArgsList(size_t capacity, CallArena& arena)
+				: _data(capacity > kInlineArgsCount ? arena.AllocateArray<T>(capacity) : _inline.data())
+				, _capacity(std::max(capacity, kInlineArgsCount)) {}
+
+			ArgsList(const ArgsList&) = delete;
+			ArgsList& operator=(const ArgsList&) = delete;
+
+			template<typename... Args>
+			T& emplace_back(Args&&... args) {
+				assert(_size < _capacity);
+				// Arena slots are raw memory, so construct in place instead of assigning
+				return *std::construct_at(_data + _size++, std::forward<Args>(args)...);
 			}
-			case ValueType::ArrayMatrix4x4: {
-				auto* const arr = ret.Get<plg::vector<plg::mat4x4>*>();
-				return CreatePyObjectList<plg::mat4x4>(*arr);
+
+			const T& operator[](size_t index) const { return _data[index]; }
+			T* data() { return _data; }
+			const T* data() const { return _data; }
+			size_t size() const { return _size; }
+
+		private:
+			std::array<T, kInlineArgsCount> _inline;
+			T* _data;
+			size_t _capacity;
+			size_t _size{};
+		};
+
+		// Replacement for plugify::Parameters which keeps the raw argument slots in ArgsList
+		class ArgsParams {
+		public:
+			ArgsParams(size_t capacity, CallArena& arena) : _args(capacity, arena) {}
+
+			template<typename T>
+			void Add(const T& value) {
+				static_assert(sizeof(T) <= sizeof(uint64_t));
+				uint64_t& slot = _args.emplace_back(0);
+				std::memcpy(&slot, &value, sizeof(T));
 			}
-			case ValueType::Vector2: {
-				const plg::vec2 val = ret.Get<plg::vec2>();
-				return CreatePyObject(val);
+
+			const uint64_t* Get() const { return _args.data(); }
+
+		private:
+			ArgsList<uint64_t> _args;
+		};
+
+		struct ArgsScope {
+			using DestroyFunc = void (*)(void*);
+
+			CallArena& arena;
+			CallArena::Mark mark;
+			ArgsParams params;
+			ArgsList<std::pair<void*, DestroyFunc>> storage; // used to store array temp memory
+
+			explicit ArgsScope(size_t size) : arena(CallArena::Get()), mark(arena.GetMark()), params(size, arena), storage(size, arena) {
 			}
-			case ValueType::Vector3: {
-				plg::vec3 val;
-				if (ValueUtils::IsHiddenParam(retType.GetType())) {
-					val = *ret.Get<plg::vec3*>();
-				} else {
-					val = ret.Get<plg::vec3>();
+
+			ArgsScope(const ArgsScope&) = delete;
+			ArgsScope& operator=(const ArgsScope&) = delete;
+
+			~ArgsScope() {
+				for (size_t i = storage.size(); i-- > 0;) {
+					const auto& [ptr, destroy] = storage[i];
+					if (destroy) {
+						destroy(ptr);
+					}
 				}
-				return CreatePyObject(val);
+				arena.Rewind(mark);
 			}
-			case ValueType::Vector4: {
-				plg::vec4 val;
-				if (ValueUtils::IsHiddenParam(retType.GetType())) {
-					val = *ret.Get<plg::vec4*>();
+
+			template<typename T, typename... Args>
+			T* Construct(Args&&... args) {
+				T* const value = new (arena.AllocateArray<T>(1)) T(std::forward<Args>(args)...);
+				if constexpr (std::is_trivially_destructible_v<T>) {
+					storage.emplace_back(value, nullptr);
 				} else {
-					val = ret.Get<plg::vec4>();
+					storage.emplace_back(value, [](void* ptr) { std::destroy_at(static_cast<T*>(ptr)); });
 				}
-				return CreatePyObject(val);
-			}
-			case ValueType::Matrix4x4: {
-				plg::mat4x4 val = *ret.Get<plg::mat4x4*>();
-				return CreatePyObject(val);
-			}
-			default: {
-				const std::string error(std::format("MakeExternalCallWithObject unsupported type {:#x}", static_cast<uint8_t>(retType.GetType())));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
-				return nullptr;
+				return value;
 			}
-			}
-		}
 
-		bool PushObjectAsParam(const Property& paramType, PyObject* pItem, ArgsScope& a) {
-			const auto PushValParam = [&a](auto&& value) {
-				if (!value) {
-					return false;
-				}
-				a.params.Add(*value);
-				return true;
-			};
-			const auto PushRefParam = [&paramType, &a](void* value) {
-				if (!value) {
-					return false;
-				}
-				a.storage.emplace_back(value, paramType.GetType());
-				a.params.Add(value);
-				return true;
-			};
-			switch (paramType.GetType()) {
-				case ValueType::Bool:
-					return PushValParam(ValueFromObject<bool>(pItem));
-				case ValueType::Char8:
-					return PushValParam(ValueFromObject<char>(pItem));
-				case ValueType::Char16:
-					return PushValParam(ValueFromObject<char16_t>(pItem));
-				case ValueType::Int8:
-					return PushValParam(ValueFromObject<int8_t>(pItem));
-				case ValueType::Int16:
-					return PushValParam(ValueFromObject<int16_t>(pItem));
-				case ValueType::Int32:
-					return PushValParam(ValueFromObject<int32_t>(pItem));
-				case ValueType::Int64:
-					return PushValParam(ValueFromObject<int64_t>(pItem));
-				case ValueType::UInt8:
-					return PushValParam(ValueFromObject<uint8_t>(pItem));
-				case ValueType::UInt16:
-					return PushValParam(ValueFromObject<uint16_t>(pItem));
-				case ValueType::UInt32:
-					return PushValParam(ValueFromObject<uint32_t>(pItem));
-				case ValueType::UInt64:
-					return PushValParam(ValueFromObject<uint64_t>(pItem));
-				case ValueType::Pointer:
-					return PushValParam(ValueFromObject<void*>(pItem));
-				case ValueType::Float:
-					return PushValParam(ValueFromObject<float>(pItem));
-				case ValueType::Double:
-					return PushValParam(ValueFromObject<double>(pItem));
-				case ValueType::String:
-					return PushRefParam(CreateValue<plg::string>(pItem));
-				case ValueType::Any:
-					return PushRefParam(CreateValue<plg::any>(pItem));
-				case ValueType::Function:
-					return PushValParam(GetOrCreateFunctionValue(*paramType.GetPrototype(), pItem));
-				case ValueType::ArrayBool:
-					return PushRefParam(CreateArray<bool>(pItem));
-				case ValueType::ArrayChar8:
-					return PushRefParam(CreateArray<char>(pItem));
-				case ValueType::ArrayChar16:
-					return PushRefParam(CreateArray<char16_t>(pItem));
-				case ValueType::ArrayInt8:
-					return PushRefParam(CreateArray<int8_t>(pItem));
-				case ValueType::ArrayInt16:
-					return PushRefParam(CreateArray<int16_t>(pItem));
-				case ValueType::ArrayInt32:
-					return PushRefParam(CreateArray<int32_t>(pItem));
-				case ValueType::ArrayInt64:
-					return PushRefParam(CreateArray<int64_t>(pItem));
-				case ValueType::ArrayUInt8:
-					return PushRefParam(CreateArray<uint8_t>(pItem));
-				case ValueType::ArrayUInt16:
-					return PushRefParam(CreateArray<uint16_t>(pItem));
-				case ValueType::ArrayUInt32:
-					return PushRefParam(CreateArray<uint32_t>(pItem));
-				case ValueType::ArrayUInt64:
-					return PushRefParam(CreateArray<uint64_t>(pItem));
-				case ValueType::ArrayPointer:
-					return PushRefParam(CreateArray<void*>(pItem));
-				case ValueType::ArrayFloat:
-					return PushRefParam(CreateArray<float>(pItem));
-				case ValueType::ArrayDouble:
-					return PushRefParam(CreateArray<double>(pItem));
-				case ValueType::ArrayString:
-					return PushRefParam(CreateArray<plg::string>(pItem));
-				case ValueType::ArrayAny:
-					return PushRefParam(CreateArray<plg::any>(pItem));
-				case ValueType::ArrayVector2:
-					return PushRefParam(CreateArray<plg::vec2>(pItem));
-				case ValueType::ArrayVector3:
-					return PushRefParam(CreateArray<plg::vec3>(pItem));
-				case ValueType::ArrayVector4:
-					return PushRefParam(CreateArray<plg::vec4>(pItem));
-				case ValueType::ArrayMatrix4x4:
-					return PushRefParam(CreateArray<plg::mat4x4>(pItem));
-				case ValueType::Vector2:
-					return PushRefParam(CreateValue<plg::vec2>(pItem));
-				case ValueType::Vector3:
-					return PushRefParam(CreateValue<plg::vec3>(pItem));
-				case ValueType::Vector4:
-					return PushRefParam(CreateValue<plg::vec4>(pItem));
-				case ValueType::Matrix4x4:
-					return PushRefParam(CreateValue<plg::mat4x4>(pItem));
-			default: {
-				const std::string error(std::format("PushObjectAsParam unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
-				return false;
-			}
+			// Container is handed back to its ContainerPool instead of being freed
+			template<typename T>
+			T* ConstructPooled(T&& container) {
+				T* const value = new (arena.AllocateArray<T>(1)) T(std::move(container));
+				storage.emplace_back(value, [](void* ptr) {
+					T* const pooled = static_cast<T*>(ptr);
+					ContainerPool<T>::Get().Release(*pooled);
+					std::destroy_at(pooled);
+				});
+				return value;
 			}
+		};
+
+		using BeginCallFunc = ExternalCallPlan::BeginCallFunc;
+		using ReturnToObjectFunc = ExternalCallPlan::ReturnToObjectFunc;
+
+		// Callee constructs the result in place, so the hidden slot must not hold pooled capacity.
+		// The returned container still goes to the pool afterwards.
+		template<typename T>
+		void BeginPooledReturn(ArgsScope& a) {
+			void* const value = a.ConstructPooled(T());
+			a.params.Add(value);
 		}
 
-		bool PushObjectAsRefParam(const Property& paramType, PyObject* pItem, ArgsScope& a) {
-			const auto PushRefParam = [&paramType, &a](void* value) {
-				if (!value) {
-					return false;
-				}
-				a.storage.emplace_back(value, paramType.GetType());
-				a.params.Add(value);
-				return true;
-			};
+		template<typename T>
+		void BeginValueReturn(ArgsScope& a) {
+			void* const value = a.Construct<T>();
+			a.params.Add(value);
+		}
 
-			switch (paramType.GetType()) {
-			case ValueType::Bool:
-				return PushRefParam(CreateValue<bool>(pItem));
-			case ValueType::Char8:
-				return PushRefParam(CreateValue<char>(pItem));
-			case ValueType::Char16:
-				return PushRefParam(CreateValue<char16_t>(pItem));
-			case ValueType::Int8:
-				return PushRefParam(CreateValue<int8_t>(pItem));
-			case ValueType::Int16:
-				return PushRefParam(CreateValue<int16_t>(pItem));
-			case ValueType::Int32:
-				return PushRefParam(CreateValue<int32_t>(pItem));
-			case ValueType::Int64:
-				return PushRefParam(CreateValue<int64_t>(pItem));
-			case ValueType::UInt8:
-				return PushRefParam(CreateValue<uint8_t>(pItem));
-			case ValueType::UInt16:
-				return PushRefParam(CreateValue<uint16_t>(pItem));
-			case ValueType::UInt32:
-				return PushRefParam(CreateValue<uint32_t>(pItem));
-			case ValueType::UInt64:
-				return PushRefParam(CreateValue<uint64_t>(pItem));
-			case ValueType::Pointer:
-				return PushRefParam(CreateValue<void*>(pItem));
-			case ValueType::Float:
-				return PushRefParam(CreateValue<float>(pItem));
-			case ValueType::Double:
-				return PushRefParam(CreateValue<double>(pItem));
+		BeginCallFunc GetBeginCallFunc(const Property& retType) {
+			switch (retType.GetType()) {
 			case ValueType::String:
-				return PushRefParam(CreateValue<plg::string>(pItem));
-			case ValueType::Any:
-				return PushRefParam(CreateValue<plg::any>(pItem));
+				return &BeginPooledReturn<plg::string>;
 			case ValueType::ArrayBool:
-				return PushRefParam(CreateArray<bool>(pItem));
+				return &BeginPooledReturn<plg::vector<bool>>;
 			case ValueType::ArrayChar8:
-				return PushRefParam(CreateArray<char>(pItem));
+				return &BeginPooledReturn<plg::vector<char>>;
 			case ValueType::ArrayChar16:
-				return PushRefParam(CreateArray<char16_t>(pItem));
+				return &BeginPooledReturn<plg::vector<char16_t>>;
 			case ValueType::ArrayInt8:
-				return PushRefParam(CreateArray<int8_t>(pItem));
+				return &BeginPooledReturn<plg::vector<int8_t>>;
 			case ValueType::ArrayInt16:
-				return PushRefParam(CreateArray<int16_t>(pItem));
+				return &BeginPooledReturn<plg::vector<int16_t>>;
 			case ValueType::ArrayInt32:
-				return PushRefParam(CreateArray<int32_t>(pItem));
+				return &BeginPooledReturn<plg::vector<int32_t>>;
 			case ValueType::ArrayInt64:
-				return PushRefParam(CreateArray<int64_t>(pItem));
+				return &BeginPooledReturn<plg::vector<int64_t>>;
 			case ValueType::ArrayUInt8:
-				return PushRefParam(CreateArray<uint8_t>(pItem));
+				return &BeginPooledReturn<plg::vector<uint8_t>>;
 			case ValueType::ArrayUInt16:
-				return PushRefParam(CreateArray<uint16_t>(pItem));
+				return &BeginPooledReturn<plg::vector<uint16_t>>;
 			case ValueType::ArrayUInt32:
-				return PushRefParam(CreateArray<uint32_t>(pItem));
+				return &BeginPooledReturn<plg::vector<uint32_t>>;
 			case ValueType::ArrayUInt64:
-				return PushRefParam(CreateArray<uint64_t>(pItem));
+				return &BeginPooledReturn<plg::vector<uint64_t>>;
 			case ValueType::ArrayPointer:
-				return PushRefParam(CreateArray<void*>(pItem));
+				return &BeginPooledReturn<plg::vector<void*>>;
 			case ValueType::ArrayFloat:
-				return PushRefParam(CreateArray<float>(pItem));
+				return &BeginPooledReturn<plg::vector<float>>;
 			case ValueType::ArrayDouble:
-				return PushRefParam(CreateArray<double>(pItem));
+				return &BeginPooledReturn<plg::vector<double>>;
 			case ValueType::ArrayString:
-				return PushRefParam(CreateArray<plg::string>(pItem));
+				return &BeginPooledReturn<plg::vector<plg::string>>;
 			case ValueType::ArrayAny:
-				return PushRefParam(CreateArray<plg::any>(pItem));
+				return &BeginPooledReturn<plg::vector<plg::any>>;
 			case ValueType::ArrayVector2:
-				return PushRefParam(CreateArray<plg::vec2>(pItem));
+				return &BeginPooledReturn<plg::vector<plg::vec2>>;
 			case ValueType::ArrayVector3:
-				return PushRefParam(CreateArray<plg::vec3>(pItem));
+				return &BeginPooledReturn<plg::vector<plg::vec3>>;
 			case ValueType::ArrayVector4:
-				return PushRefParam(CreateArray<plg::vec4>(pItem));
+				return &BeginPooledReturn<plg::vector<plg::vec4>>;
 			case ValueType::ArrayMatrix4x4:
-				return PushRefParam(CreateArray<plg::mat4x4>(pItem));
+				return &BeginPooledReturn<plg::vector<plg::mat4x4>>;
+			case ValueType::Any:
+				return &BeginValueReturn<plg::any>;
 			case ValueType::Vector2:
-				return PushRefParam(CreateValue<plg::vec2>(pItem));
+				return &BeginValueReturn<plg::vec2>;
 			case ValueType::Vector3:
-				return PushRefParam(CreateValue<plg::vec3>(pItem));
+				return &BeginValueReturn<plg::vec3>;
 			case ValueType::Vector4:
-				return PushRefParam(CreateValue<plg::vec4>(pItem));
+				return &BeginValueReturn<plg::vec4>;
 			case ValueType::Matrix4x4:
-				return PushRefParam(CreateValue<plg::mat4x4>(pItem));
+				return &BeginValueReturn<plg::mat4x4>;
 			default: {
-				const std::string error(std::format("PushObjectAsRefParam unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
-				return false;
+				const std::string error(std::format(LOG_PREFIX "BeginExternalCall unsupported type {:#x}", static_cast<uint8_t>(retType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
+				return nullptr;
 			}
 			}
 		}
 
-		PyObject* StorageValueToEnumObject(const Property& paramType, const ArgsScope& a, size_t index) {
-			const auto& enumerator = *paramType.GetEnumerate();
-			switch (paramType.GetType()) {
+		// Arguments are fully marshalled and the result is built after the GIL is taken back,
+		// so only the native function runs without it
+		void InvokeExternal(JitCall::CallingFunc func, const ArgsScope& a, Return& ret, bool releaseGil) {
+			if (releaseGil) {
+				Py_BEGIN_ALLOW_THREADS
+				func(a.params.Get(), &ret);
+				Py_END_ALLOW_THREADS
+			} else {
+				func(a.params.Get(), &ret);
+			}
+		}
+
+		PyObject* VoidReturnToObject([[maybe_unused]] const Property& retType, [[maybe_unused]] Return& ret) {
+			Py_RETURN_NONE;
+		}
+
+		template<typename T>
+		PyObject* ValueReturnToObject([[maybe_unused]] const Property& retType, Return& ret) {
+			const T value = ret.Get<T>();
+			return CreatePyObject(value);
+		}
+
+		// Returned through the hidden param slot
+		template<typename T>
+		PyObject* HiddenReturnToObject([[maybe_unused]] const Property& retType, Return& ret) {
+			auto* const value = ret.Get<T*>();
+			return CreatePyObject(*value);
+		}
+
+		template<typename T>
+		PyObject* ArrayReturnToObject([[maybe_unused]] const Property& retType, Return& ret) {
+			auto* const arr = ret.Get<plg::vector<T>*>();
+			return CreatePyObjectList<T>(*arr);
+		}
+
+		PyObject* FunctionReturnToObject(const Property& retType, Return& ret) {
+			void* const value = ret.Get<void*>();
+			return GetOrCreateFunctionObject(*retType.GetPrototype(), value);
+		}
+
+		template<typename T>
+		PyObject* EnumReturnToObject(const Property& retType, Return& ret) {
+			const T value = ret.Get<T>();
+			return CreatePyEnumObject(*retType.GetEnumerate(), value);
+		}
+
+		template<typename T>
+		PyObject* EnumArrayReturnToObject(const Property& retType, Return& ret) {
+			auto* const arr = ret.Get<plg::vector<T>*>();
+			return CreatePyEnumObjectList<T>(*retType.GetEnumerate(), *arr);
+		}
+
+		ReturnToObjectFunc GetEnumReturnToObjectFunc(const Property& retType) {
+			switch (retType.GetType()) {
 			case ValueType::Int8:
-				return CreatePyEnumObject(enumerator, *static_cast<int8_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<int8_t>;
 			case ValueType::Int16:
-				return CreatePyEnumObject(enumerator, *static_cast<int16_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<int16_t>;
 			case ValueType::Int32:
-				return CreatePyEnumObject(enumerator, *static_cast<int32_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<int32_t>;
 			case ValueType::Int64:
-				return CreatePyEnumObject(enumerator, *static_cast<int64_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<int64_t>;
 			case ValueType::UInt8:
-				return CreatePyEnumObject(enumerator, *static_cast<uint8_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<uint8_t>;
 			case ValueType::UInt16:
-				return CreatePyEnumObject(enumerator, *static_cast<uint16_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<uint16_t>;
 			case ValueType::UInt32:
-				return CreatePyEnumObject(enumerator, *static_cast<uint32_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<uint32_t>;
 			case ValueType::UInt64:
-				return CreatePyEnumObject(enumerator, *static_cast<uint64_t*>(std::get<0>(a.storage[index])));
+				return &EnumReturnToObject<uint64_t>;
 			case ValueType::ArrayInt8:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<int8_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<int8_t>;
 			case ValueType::ArrayInt16:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<int16_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<int16_t>;
 			case ValueType::ArrayInt32:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<int32_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<int32_t>;
 			case ValueType::ArrayInt64:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<int64_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<int64_t>;
 			case ValueType::ArrayUInt8:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<uint8_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<uint8_t>;
 			case ValueType::ArrayUInt16:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<uint16_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<uint16_t>;
 			case ValueType::ArrayUInt32:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<uint32_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<uint32_t>;
 			case ValueType::ArrayUInt64:
-				return CreatePyEnumObjectList(enumerator, *static_cast<plg::vector<uint64_t>*>(std::get<0>(a.storage[index])));
+				return &EnumArrayReturnToObject<uint64_t>;
 			default: {
-				const std::string error(std::format("StorageValueToObject unsupported enum type {:#x}", static_cast<uint8_t>(paramType.GetType())));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
+				const std::string error(std::format(LOG_PREFIX "ReturnToEnumObject unsupported type {:#x}", static_cast<uint8_t>(retType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
 				return nullptr;
 			}
 			}
 		}
 
-		PyObject* StorageValueToObject(const Property& paramType, const ArgsScope& a, size_t index) {
-			switch (paramType.GetType()) {
+		// Vector3/Vector4 come back in registers or through the hidden slot depending on the platform ABI
+		ReturnToObjectFunc GetReturnToObjectFunc(const Property& retType) {
+			if (retType.GetEnumerate()) {
+				return GetEnumReturnToObjectFunc(retType);
+			}
+			const ValueType type = retType.GetType();
+			switch (type) {
+			case ValueType::Void:
+				return &VoidReturnToObject;
 			case ValueType::Bool:
-				return CreatePyObject(*static_cast<bool*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<bool>;
 			case ValueType::Char8:
-				return CreatePyObject(*static_cast<char*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<char>;
 			case ValueType::Char16:
-				return CreatePyObject(*static_cast<char16_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<char16_t>;
 			case ValueType::Int8:
-				return CreatePyObject(*static_cast<int8_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<int8_t>;
 			case ValueType::Int16:
-				return CreatePyObject(*static_cast<int16_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<int16_t>;
 			case ValueType::Int32:
-				return CreatePyObject(*static_cast<int32_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<int32_t>;
 			case ValueType::Int64:
-				return CreatePyObject(*static_cast<int64_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<int64_t>;
 			case ValueType::UInt8:
-				return CreatePyObject(*static_cast<uint8_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<uint8_t>;
 			case ValueType::UInt16:
-				return CreatePyObject(*static_cast<uint16_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<uint16_t>;
 			case ValueType::UInt32:
-				return CreatePyObject(*static_cast<uint32_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<uint32_t>;
 			case ValueType::UInt64:
-				return CreatePyObject(*static_cast<uint64_t*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<uint64_t>;
+			case ValueType::Pointer:
+				return &ValueReturnToObject<void*>;
 			case ValueType::Float:
-				return CreatePyObject(*static_cast<float*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<float>;
 			case ValueType::Double:
-				return CreatePyObject(*static_cast<double*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<double>;
+			case ValueType::Function:
+				return &FunctionReturnToObject;
 			case ValueType::String:
-				return CreatePyObject(*static_cast<plg::string*>(std::get<0>(a.storage[index])));
+				return &HiddenReturnToObject<plg::string>;
 			case ValueType::Any:
-				return CreatePyObject(*static_cast<plg::any*>(std::get<0>(a.storage[index])));
-			case ValueType::Pointer:
-				return CreatePyObject(*static_cast<void**>(std::get<0>(a.storage[index])));
+				return &HiddenReturnToObject<plg::any>;
 			case ValueType::ArrayBool:
-				return CreatePyObjectList(*static_cast<plg::vector<bool>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<bool>;
 			case ValueType::ArrayChar8:
-				return CreatePyObjectList(*static_cast<plg::vector<char>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<char>;
 			case ValueType::ArrayChar16:
-				return CreatePyObjectList(*static_cast<plg::vector<char16_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<char16_t>;
 			case ValueType::ArrayInt8:
-				return CreatePyObjectList(*static_cast<plg::vector<int8_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<int8_t>;
 			case ValueType::ArrayInt16:
-				return CreatePyObjectList(*static_cast<plg::vector<int16_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<int16_t>;
 			case ValueType::ArrayInt32:
-				return CreatePyObjectList(*static_cast<plg::vector<int32_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<int32_t>;
 			case ValueType::ArrayInt64:
-				return CreatePyObjectList(*static_cast<plg::vector<int64_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<int64_t>;
 			case ValueType::ArrayUInt8:
-				return CreatePyObjectList(*static_cast<plg::vector<uint8_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<uint8_t>;
 			case ValueType::ArrayUInt16:
-				return CreatePyObjectList(*static_cast<plg::vector<uint16_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<uint16_t>;
 			case ValueType::ArrayUInt32:
-				return CreatePyObjectList(*static_cast<plg::vector<uint32_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<uint32_t>;
 			case ValueType::ArrayUInt64:
-				return CreatePyObjectList(*static_cast<plg::vector<uint64_t>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<uint64_t>;
 			case ValueType::ArrayPointer:
-				return CreatePyObjectList(*static_cast<plg::vector<void*>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<void*>;
 			case ValueType::ArrayFloat:
-				return CreatePyObjectList(*static_cast<plg::vector<float>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<float>;
 			case ValueType::ArrayDouble:
-				return CreatePyObjectList(*static_cast<plg::vector<double>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<double>;
 			case ValueType::ArrayString:
-				return CreatePyObjectList(*static_cast<plg::vector<plg::string>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<plg::string>;
 			case ValueType::ArrayAny:
-				return CreatePyObjectList(*static_cast<plg::vector<plg::any>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<plg::any>;
 			case ValueType::ArrayVector2:
-				return CreatePyObjectList(*static_cast<plg::vector<plg::vec2>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<plg::vec2>;
 			case ValueType::ArrayVector3:
-				return CreatePyObjectList(*static_cast<plg::vector<plg::vec3>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<plg::vec3>;
 			case ValueType::ArrayVector4:
-				return CreatePyObjectList(*static_cast<plg::vector<plg::vec4>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<plg::vec4>;
 			case ValueType::ArrayMatrix4x4:
-				return CreatePyObjectList(*static_cast<plg::vector<plg::mat4x4>*>(std::get<0>(a.storage[index])));
+				return &ArrayReturnToObject<plg::mat4x4>;
 			case ValueType::Vector2:
-				return CreatePyObject(*static_cast<plg::vec2*>(std::get<0>(a.storage[index])));
+				return &ValueReturnToObject<plg::vec2>;
 			case ValueType::Vector3:
-				return CreatePyObject(*static_cast<plg::vec3*>(std::get<0>(a.storage[index])));
+				return ValueUtils::IsHiddenParam(type) ? &HiddenReturnToObject<plg::vec3> : &ValueReturnToObject<plg::vec3>;
 			case ValueType::Vector4:
-				return CreatePyObject(*static_cast<plg::vec4*>(std::get<0>(a.storage[index])));
+				return ValueUtils::IsHiddenParam(type) ? &HiddenReturnToObject<plg::vec4> : &ValueReturnToObject<plg::vec4>;
 			case ValueType::Matrix4x4:
-				return CreatePyObject(*static_cast<plg::mat4x4*>(std::get<0>(a.storage[index])));
+				return &HiddenReturnToObject<plg::mat4x4>;
 			default: {
-				const std::string error(std::format("StorageValueToObject unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
+				const std::string error(std::format(LOG_PREFIX "ReturnToObject unsupported type {:#x}", static_cast<uint8_t>(retType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
 				return nullptr;
 			}
 			}
 		}
 
-		// PyObject* (MethodPyCall*)(PyObject* self, PyObject* args)
-		void ExternalCallNoArgs(const Method* method, MemAddr data, [[maybe_unused]] uint64_t* parameters, [[maybe_unused]] size_t count, void* return_) {
-			//ParametersSpan params(parameters, count);
-			ReturnSlot ret(return_, ValueUtils::SizeOf(ValueType::Pointer));
-
-			const Property& retType = method->GetRetType();
-			const bool hasHiddenParam = ValueUtils::IsHiddenParam(retType.GetType());
-
-			ArgsScope a(hasHiddenParam);
-			Return r;
+		using PushParamFunc = ExternalCallPlan::PushParamFunc;
 
-			if (hasHiddenParam) {
-				BeginExternalCall(retType.GetType(), a);
+		template<typename T>
+		bool PushValueParam([[maybe_unused]] const Property& paramType, PyObject* pItem, ArgsScope& a) {
+			if (auto value = ValueFromObject<T>(pItem)) {
+				a.params.Add(*value);
+				return true;
 			}
+			return false;
+		}
 
-			using MakeExternalCallFunc = PyObject* (*)(const Property&, JitCall::CallingFunc, const ArgsScope&, Return&);
-			MakeExternalCallFunc const makeExternalCallFunc = retType.GetEnumerate() ? &MakeExternalCallWithEnumObject : &MakeExternalCallWithObject;
-			PyObject* const retObj = makeExternalCallFunc(retType, data.RCast<JitCall::CallingFunc>(), a, r);
-			if (!retObj) {
-				// makeExternalCallFunc set error
-				ret.Set<void*>(nullptr);
-				return;
+		bool PushFunctionParam(const Property& paramType, PyObject* pItem, ArgsScope& a) {
+			if (auto value = GetOrCreateFunctionValue(*paramType.GetPrototype(), pItem)) {
+				a.params.Add(*value);
+				return true;
 			}
-			ret.Set(retObj);
+			return false;
 		}
 
-		void ExternalCall(const Method* method, MemAddr data, uint64_t* parameters, size_t count, void* return_) {
-			ParametersSpan params(parameters, count);
-			ReturnSlot ret(return_, ValueUtils::SizeOf(ValueType::Pointer));
-
-			// PyObject* (MethodPyCall*)(PyObject* self, PyObject* args)
-			const auto args = params.Get<PyObject*>(1);
-
-			if (!PyTuple_Check(args)) {
-				const std::string error(std::format("Function \"{}\" expects a tuple of arguments", method->GetFuncName()));
-				SetTypeError(error, args);
-				ret.Set<void*>(nullptr);
-				return;
+		// Values which are passed by pointer live in ArgsScope storage until the call ends
+		template<typename T>
+		bool PushStorageValue([[maybe_unused]] const Property& paramType, PyObject* pItem, ArgsScope& a) {
+			if (auto value = ValueFromObject<T>(pItem)) {
+				a.params.Add(a.Construct<T>(std::move(*value)));
+				return true;
 			}
+			return false;
+		}
 
-			const auto& paramTypes = method->GetParamTypes();
-			const auto paramCount = paramTypes.size();
-			const Py_ssize_t size = PyTuple_Size(args);
-			if (size != static_cast<Py_ssize_t>(paramCount)) {
-				const std::string error(std::format("Wrong number of parameters, {} when {} required.", size, paramCount));
-				PyErr_SetString(PyExc_TypeError, error.c_str());
-				ret.Set<void*>(nullptr);
-				return;
+		bool PushStorageString([[maybe_unused]] const Property& paramType, PyObject* pItem, ArgsScope& a) {
+			if (!PyUnicode_Check(pItem)) {
+				SetTypeError("Expected string", pItem);
+				return false;
 			}
+			plg::string* const value = a.ConstructPooled(ContainerPool<plg::string>::Get().Acquire());
+			value->assign(PyUnicode_AsString(pItem));
+			a.params.Add(value);
+			return true;
+		}
 
-			const Property& retType = method->GetRetType();
-			const bool hasHiddenParam = ValueUtils::IsHiddenParam(retType.GetType());
-			Py_ssize_t refParamsCount = 0;
-
-			ArgsScope a(hasHiddenParam + paramCount);
-			Return r;
-
-			if (hasHiddenParam) {
-				BeginExternalCall(retType.GetType(), a);
+		template<typename T>
+		bool PushStorageArray([[maybe_unused]] const Property& paramType, PyObject* pItem, ArgsScope& a) {
+			// Pooled container is released by ArgsScope even when conversion fails
+			plg::vector<T>* const array = a.ConstructPooled(ContainerPool<plg::vector<T>>::Get().Acquire());
+			if (!FillArrayFromObject(pItem, *array)) {
+				return false;
 			}
+			a.params.Add(array);
+			return true;
+		}
 
-			for (Py_ssize_t i = 0; i < size; ++i) {
-				const Property& paramType = paramTypes[i];
-				if (paramType.IsRef()) {
-					++refParamsCount;
-				}
-				using PushParamFunc = bool (*)(const Property&, PyObject*, ArgsScope&);
-				PushParamFunc const pushParamFunc = paramType.IsRef() ? &PushObjectAsRefParam : &PushObjectAsParam;
-				const bool pushResult = pushParamFunc(paramType, PyTuple_GetItem(args, i), a);
-				if (!pushResult) {
-					// pushParamFunc set error
-					ret.Set<void*>(nullptr);
-					return;
-				}
-			}
+		PushParamFunc GetPushParamFunc(const Property& paramType) {
+			switch (paramType.GetType()) {
+			case ValueType::Bool:
+				return &PushValueParam<bool>;
+			case ValueType::Char8:
+				return &PushValueParam<char>;
+			case ValueType::Char16:
+				return &PushValueParam<char16_t>;
+			case ValueType::Int8:
+				return &PushValueParam<int8_t>;
+			case ValueType::Int16:
+				return &PushValueParam<int16_t>;
+			case ValueType::Int32:
+				return &PushValueParam<int32_t>;
+			case ValueType::Int64:
+				return &PushValueParam<int64_t>;
+			case ValueType::UInt8:
+				return &PushValueParam<uint8_t>;
+			case ValueType::UInt16:
+				return &PushValueParam<uint16_t>;
+			case ValueType::UInt32:
+				return &PushValueParam<uint32_t>;
+			case ValueType::UInt64:
+				return &PushValueParam<uint64_t>;
+			case ValueType::Pointer:
+				return &PushValueParam<void*>;
+			case ValueType::Float:
+				return &PushValueParam<float>;
+			case ValueType::Double:
+				return &PushValueParam<double>;
+			case ValueType::String:
+				return &PushStorageString;
+			case ValueType::Any:
+				return &PushStorageValue<plg::any>;
+			case ValueType::Function:
+				return &PushFunctionParam;
+			case ValueType::ArrayBool:
+				return &PushStorageArray<bool>;
+			case ValueType::ArrayChar8:
+				return &PushStorageArray<char>;
+			case ValueType::ArrayChar16:
+				return &PushStorageArray<char16_t>;
+			case ValueType::ArrayInt8:
+				return &PushStorageArray<int8_t>;
+			case ValueType::ArrayInt16:
+				return &PushStorageArray<int16_t>;
+			case ValueType::ArrayInt32:
+				return &PushStorageArray<int32_t>;
+			case ValueType::ArrayInt64:
+				return &PushStorageArray<int64_t>;
+			case ValueType::ArrayUInt8:
+				return &PushStorageArray<uint8_t>;
+			case ValueType::ArrayUInt16:
+				return &PushStorageArray<uint16_t>;
+			case ValueType::ArrayUInt32:
+				return &PushStorageArray<uint32_t>;
+			case ValueType::ArrayUInt64:
+				return &PushStorageArray<uint64_t>;
+			case ValueType::ArrayPointer:
+				return &PushStorageArray<void*>;
+			case ValueType::ArrayFloat:
+				return &PushStorageArray<float>;
+			case ValueType::ArrayDouble:
+				return &PushStorageArray<double>;
+			case ValueType::ArrayString:
+				return &PushStorageArray<plg::string>;
+			case ValueType::ArrayAny:
+				return &PushStorageArray<plg::any>;
+			case ValueType::ArrayVector2:
+				return &PushStorageArray<plg::vec2>;
+			case ValueType::ArrayVector3:
+				return &PushStorageArray<plg::vec3>;
+			case ValueType::ArrayVector4:
+				return &PushStorageArray<plg::vec4>;
+			case ValueType::ArrayMatrix4x4:
+				return &PushStorageArray<plg::mat4x4>;
+			case ValueType::Vector2:
+				return &PushStorageValue<plg::vec2>;
+			case ValueType::Vector3:
+				return &PushStorageValue<plg::vec3>;
+			case ValueType::Vector4:
+				return &PushStorageValue<plg::vec4>;
+			case ValueType::Matrix4x4:
+				return &PushStorageValue<plg::mat4x4>;
+			default: {
+				const std::string error(std::format(LOG_PREFIX "PushObjectAsParam unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
+				return nullptr;
+			}
+			}
+		}
+
+		PushParamFunc GetPushRefParamFunc(const Property& paramType) {
+			switch (paramType.GetType()) {
+			case ValueType::Bool:
+				return &PushStorageValue<bool>;
+			case ValueType::Char8:
+				return &PushStorageValue<char>;
+			case ValueType::Char16:
+				return &PushStorageValue<char16_t>;
+			case ValueType::Int8:
+				return &PushStorageValue<int8_t>;
+			case ValueType::Int16:
+				return &PushStorageValue<int16_t>;
+			case ValueType::Int32:
+				return &PushStorageValue<int32_t>;
+			case ValueType::Int64:
+				return &PushStorageValue<int64_t>;
+			case ValueType::UInt8:
+				return &PushStorageValue<uint8_t>;
+			case ValueType::UInt16:
+				return &PushStorageValue<uint16_t>;
+			case ValueType::UInt32:
+				return &PushStorageValue<uint32_t>;
+			case ValueType::UInt64:
+				return &PushStorageValue<uint64_t>;
+			case ValueType::Pointer:
+				return &PushStorageValue<void*>;
+			case ValueType::Float:
+				return &PushStorageValue<float>;
+			case ValueType::Double:
+				return &PushStorageValue<double>;
+			case ValueType::String:
+				return &PushStorageString;
+			case ValueType::Any:
+				return &PushStorageValue<plg::any>;
+			case ValueType::ArrayBool:
+				return &PushStorageArray<bool>;
+			case ValueType::ArrayChar8:
+				return &PushStorageArray<char>;
+			case ValueType::ArrayChar16:
+				return &PushStorageArray<char16_t>;
+			case ValueType::ArrayInt8:
+				return &PushStorageArray<int8_t>;
+			case ValueType::ArrayInt16:
+				return &PushStorageArray<int16_t>;
+			case ValueType::ArrayInt32:
+				return &PushStorageArray<int32_t>;
+			case ValueType::ArrayInt64:
+				return &PushStorageArray<int64_t>;
+			case ValueType::ArrayUInt8:
+				return &PushStorageArray<uint8_t>;
+			case ValueType::ArrayUInt16:
+				return &PushStorageArray<uint16_t>;
+			case ValueType::ArrayUInt32:
+				return &PushStorageArray<uint32_t>;
+			case ValueType::ArrayUInt64:
+				return &PushStorageArray<uint64_t>;
+			case ValueType::ArrayPointer:
+				return &PushStorageArray<void*>;
+			case ValueType::ArrayFloat:
+				return &PushStorageArray<float>;
+			case ValueType::ArrayDouble:
+				return &PushStorageArray<double>;
+			case ValueType::ArrayString:
+				return &PushStorageArray<plg::string>;
+			case ValueType::ArrayAny:
+				return &PushStorageArray<plg::any>;
+			case ValueType::ArrayVector2:
+				return &PushStorageArray<plg::vec2>;
+			case ValueType::ArrayVector3:
+				return &PushStorageArray<plg::vec3>;
+			case ValueType::ArrayVector4:
+				return &PushStorageArray<plg::vec4>;
+			case ValueType::ArrayMatrix4x4:
+				return &PushStorageArray<plg::mat4x4>;
+			case ValueType::Vector2:
+				return &PushStorageValue<plg::vec2>;
+			case ValueType::Vector3:
+				return &PushStorageValue<plg::vec3>;
+			case ValueType::Vector4:
+				return &PushStorageValue<plg::vec4>;
+			case ValueType::Matrix4x4:
+				return &PushStorageValue<plg::mat4x4>;
+			default: {
+				const std::string error(std::format(LOG_PREFIX "PushObjectAsRefParam unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
+				return nullptr;
+			}
+			}
+		}
+
+		using StoreValueFunc = ExternalCallPlan::StoreValueFunc;
+
+		template<typename T>
+		PyObject* StorageValueToObject([[maybe_unused]] const Property& paramType, const ArgsScope& a, size_t index) {
+			return CreatePyObject(*static_cast<T*>(std::get<0>(a.storage[index])));
+		}
+
+		template<typename T>
+		PyObject* StorageArrayToObject([[maybe_unused]] const Property& paramType, const ArgsScope& a, size_t index) {
+			return CreatePyObjectList(*static_cast<plg::vector<T>*>(std::get<0>(a.storage[index])));
+		}
+
+		template<typename T>
+		PyObject* StorageValueToEnumObject(const Property& paramType, const ArgsScope& a, size_t index) {
+			return CreatePyEnumObject(*paramType.GetEnumerate(), *static_cast<T*>(std::get<0>(a.storage[index])));
+		}
+
+		template<typename T>
+		PyObject* StorageArrayToEnumObject(const Property& paramType, const ArgsScope& a, size_t index) {
+			return CreatePyEnumObjectList(*paramType.GetEnumerate(), *static_cast<plg::vector<T>*>(std::get<0>(a.storage[index])));
+		}
+
+		StoreValueFunc GetStoreEnumValueFunc(const Property& paramType) {
+			switch (paramType.GetType()) {
+			case ValueType::Int8:
+				return &StorageValueToEnumObject<int8_t>;
+			case ValueType::Int16:
+				return &StorageValueToEnumObject<int16_t>;
+			case ValueType::Int32:
+				return &StorageValueToEnumObject<int32_t>;
+			case ValueType::Int64:
+				return &StorageValueToEnumObject<int64_t>;
+			case ValueType::UInt8:
+				return &StorageValueToEnumObject<uint8_t>;
+			case ValueType::UInt16:
+				return &StorageValueToEnumObject<uint16_t>;
+			case ValueType::UInt32:
+				return &StorageValueToEnumObject<uint32_t>;
+			case ValueType::UInt64:
+				return &StorageValueToEnumObject<uint64_t>;
+			case ValueType::ArrayInt8:
+				return &StorageArrayToEnumObject<int8_t>;
+			case ValueType::ArrayInt16:
+				return &StorageArrayToEnumObject<int16_t>;
+			case ValueType::ArrayInt32:
+				return &StorageArrayToEnumObject<int32_t>;
+			case ValueType::ArrayInt64:
+				return &StorageArrayToEnumObject<int64_t>;
+			case ValueType::ArrayUInt8:
+				return &StorageArrayToEnumObject<uint8_t>;
+			case ValueType::ArrayUInt16:
+				return &StorageArrayToEnumObject<uint16_t>;
+			case ValueType::ArrayUInt32:
+				return &StorageArrayToEnumObject<uint32_t>;
+			case ValueType::ArrayUInt64:
+				return &StorageArrayToEnumObject<uint64_t>;
+			default: {
+				const std::string error(std::format(LOG_PREFIX "StorageValueToEnumObject unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
+				return nullptr;
+			}
+			}
+		}
+
+		StoreValueFunc GetStoreValueFunc(const Property& paramType) {
+			if (paramType.GetEnumerate()) {
+				return GetStoreEnumValueFunc(paramType);
+			}
+			switch (paramType.GetType()) {
+			case ValueType::Bool:
+				return &StorageValueToObject<bool>;
+			case ValueType::Char8:
+				return &StorageValueToObject<char>;
+			case ValueType::Char16:
+				return &StorageValueToObject<char16_t>;
+			case ValueType::Int8:
+				return &StorageValueToObject<int8_t>;
+			case ValueType::Int16:
+				return &StorageValueToObject<int16_t>;
+			case ValueType::Int32:
+				return &StorageValueToObject<int32_t>;
+			case ValueType::Int64:
+				return &StorageValueToObject<int64_t>;
+			case ValueType::UInt8:
+				return &StorageValueToObject<uint8_t>;
+			case ValueType::UInt16:
+				return &StorageValueToObject<uint16_t>;
+			case ValueType::UInt32:
+				return &StorageValueToObject<uint32_t>;
+			case ValueType::UInt64:
+				return &StorageValueToObject<uint64_t>;
+			case ValueType::Pointer:
+				return &StorageValueToObject<void*>;
+			case ValueType::Float:
+				return &StorageValueToObject<float>;
+			case ValueType::Double:
+				return &StorageValueToObject<double>;
+			case ValueType::String:
+				return &StorageValueToObject<plg::string>;
+			case ValueType::Any:
+				return &StorageValueToObject<plg::any>;
+			case ValueType::ArrayBool:
+				return &StorageArrayToObject<bool>;
+			case ValueType::ArrayChar8:
+				return &StorageArrayToObject<char>;
+			case ValueType::ArrayChar16:
+				return &StorageArrayToObject<char16_t>;
+			case ValueType::ArrayInt8:
+				return &StorageArrayToObject<int8_t>;
+			case ValueType::ArrayInt16:
+				return &StorageArrayToObject<int16_t>;
+			case ValueType::ArrayInt32:
+				return &StorageArrayToObject<int32_t>;
+			case ValueType::ArrayInt64:
+				return &StorageArrayToObject<int64_t>;
+			case ValueType::ArrayUInt8:
+				return &StorageArrayToObject<uint8_t>;
+			case ValueType::ArrayUInt16:
+				return &StorageArrayToObject<uint16_t>;
+			case ValueType::ArrayUInt32:
+				return &StorageArrayToObject<uint32_t>;
+			case ValueType::ArrayUInt64:
+				return &StorageArrayToObject<uint64_t>;
+			case ValueType::ArrayPointer:
+				return &StorageArrayToObject<void*>;
+			case ValueType::ArrayFloat:
+				return &StorageArrayToObject<float>;
+			case ValueType::ArrayDouble:
+				return &StorageArrayToObject<double>;
+			case ValueType::ArrayString:
+				return &StorageArrayToObject<plg::string>;
+			case ValueType::ArrayAny:
+				return &StorageArrayToObject<plg::any>;
+			case ValueType::ArrayVector2:
+				return &StorageArrayToObject<plg::vec2>;
+			case ValueType::ArrayVector3:
+				return &StorageArrayToObject<plg::vec3>;
+			case ValueType::ArrayVector4:
+				return &StorageArrayToObject<plg::vec4>;
+			case ValueType::ArrayMatrix4x4:
+				return &StorageArrayToObject<plg::mat4x4>;
+			case ValueType::Vector2:
+				return &StorageValueToObject<plg::vec2>;
+			case ValueType::Vector3:
+				return &StorageValueToObject<plg::vec3>;
+			case ValueType::Vector4:
+				return &StorageValueToObject<plg::vec4>;
+			case ValueType::Matrix4x4:
+				return &StorageValueToObject<plg::mat4x4>;
+			default: {
+				const std::string error(std::format(LOG_PREFIX "StorageValueToObject unsupported type {:#x}", static_cast<uint8_t>(paramType.GetType())));
+				g_py3lm.LogFatal(error);
+				std::terminate();
+				return nullptr;
+			}
+			}
+		}
+
+		// Every external function shares these entry points, the plan is the function's self
+		constexpr const char* kExternalCallPlanCapsule = "plugify.ExternalCallPlan";
+
+		const ExternalCallPlan& GetExternalCallPlan(PyObject* self) {
+			return *static_cast<const ExternalCallPlan*>(PyCapsule_GetPointer(self, kExternalCallPlanCapsule));
+		}
+
+		// Plan of a function object made by CreateExternalFunction, nullptr for any other object
+		const ExternalCallPlan* FindExternalCallPlan(PyObject* object) {
+			if (!PyCFunction_Check(object)) {
+				return nullptr;
+			}
+			PyObject* const self = PyCFunction_GET_SELF(object);
+			if (!self || !PyCapsule_IsValid(self, kExternalCallPlanCapsule)) {
+				return nullptr;
+			}
+			return &GetExternalCallPlan(self);
+		}
+
+		// PyObject* (PyCFunction)(PyObject* self, PyObject* args)
+		PyObject* ExternalCallNoArgs(PyObject* self, [[maybe_unused]] PyObject* args) {
+			const ExternalCallPlan& plan = GetExternalCallPlan(self);
+			const Property& retType = plan.method->GetRetType();
+
+			ArgsScope a(plan.hasHiddenParam);
+			Return r;
+
+			if (plan.beginCallFunc) {
+				plan.beginCallFunc(a);
+			}
+
+			InvokeExternal(plan.func, a, r, plan.releaseGil);
+
+			// returnToObjectFunc sets error on failure
+			return plan.returnToObjectFunc(retType, r);
+		}
+
+		// PyObject* (_PyCFunctionFast)(PyObject* self, PyObject* const* args, Py_ssize_t nargs)
+		PyObject* ExternalCall(PyObject* self, PyObject* const* args, Py_ssize_t size) {
+			const ExternalCallPlan& plan = GetExternalCallPlan(self);
+
+			const auto& paramTypes = plan.method->GetParamTypes();
+			const auto paramCount = plan.pushParamFuncs.size();
+			if (size != static_cast<Py_ssize_t>(paramCount)) {
+				const std::string error(std::format("Wrong number of parameters, {} when {} required.", size, paramCount));
+				PyErr_SetString(PyExc_TypeError, error.c_str());
+				return nullptr;
+			}
+
+			const Property& retType = plan.method->GetRetType();
+			const auto refParamsCount = static_cast<Py_ssize_t>(plan.refParams.size());
+
+			ArgsScope a(plan.hasHiddenParam + paramCount);
+			Return r;
+
+			if (plan.beginCallFunc) {
+				plan.beginCallFunc(a);
+			}
 
-			using MakeExternalCallFunc = PyObject* (*)(const Property&, JitCall::CallingFunc, const ArgsScope&, Return&);
-			MakeExternalCallFunc const makeExternalCallFunc = retType.GetEnumerate() ? &MakeExternalCallWithEnumObject : &MakeExternalCallWithObject;
-			PyObject* retObj = makeExternalCallFunc(retType, data.RCast<JitCall::CallingFunc>(), a, r);
+			for (size_t i = 0; i < paramCount; ++i) {
+				if (!plan.pushParamFuncs[i](paramTypes[i], args[i], a)) {
+					// pushParamFunc set error
+					return nullptr;
+				}
+			}
+
+			InvokeExternal(plan.func, a, r, plan.releaseGil);
+
+			PyObject* retObj = plan.returnToObjectFunc(retType, r);
 			if (!retObj) {
-				// makeExternalCallFunc set error
-				ret.Set<void*>(nullptr);
-				return;
+				// returnToObjectFunc set error
+				return nullptr;
 			}
 
 			if (refParamsCount) {
@@ -3002,61 +3342,1627 @@ namespace py3lm {
 
 				PyTuple_SET_ITEM(retTuple, k++, retObj); // retObj ref taken by tuple
 
-				for (Py_ssize_t i = 0, j = hasHiddenParam; i < size; ++i) {
-					const Property& paramType = paramTypes[i];
-					if (!paramType.IsRef()) {
-						continue;
-					}
-					using StoreValueFunc = PyObject* (*)(const Property&, const ArgsScope&, size_t);
-					StoreValueFunc const storeValueFunc = paramType.GetEnumerate() ? &StorageValueToEnumObject : &StorageValueToObject;
-					PyObject* const value = storeValueFunc(paramType, a, j++);
+				for (const auto& [paramIndex, storageIndex, storeValueFunc] : plan.refParams) {
+					PyObject* const value = storeValueFunc(paramTypes[paramIndex], a, storageIndex);
 					if (!value) {
 						// StorageValueToObject set error
 						Py_DECREF(retTuple);
-						ret.Set<void*>(nullptr);
-						return;
+						return nullptr;
 					}
 					PyTuple_SET_ITEM(retTuple, k++, value);
-					if (k >= refParamsCount + 1) {
-						break;
-					}
 				}
 
 				retObj = retTuple;
 			}
 
-			ret.Set<PyObject*>(retObj);
+			return retObj;
 		}
 
-		template<typename T>
-		std::optional<T> GetObjectAttrAsValue(PyObject* object, const char* attr_name) {
-			PyObject* const attrObject = PyObject_GetAttrString(object, attr_name);
-			if (!attrObject) {
-				// PyObject_GetAttrString set error. e.g. AttributeError
-				return std::nullopt;
+		// Binds a plan to the shared entry points, the plan and def must outlive the function object
+		PyObject* CreateExternalFunction(PyMethodDef& def, ExternalCallPlan& plan, PyObject* moduleName) {
+			const bool noArgs = plan.method->GetParamTypes().empty();
+			def.ml_meth = noArgs ? &ExternalCallNoArgs : reinterpret_cast<PyCFunction>(reinterpret_cast<void*>(&ExternalCall));
+			def.ml_flags = noArgs ? METH_NOARGS : METH_FASTCALL;
+			def.ml_doc = nullptr;
+
+			PyObject* const self = PyCapsule_New(&plan, kExternalCallPlanCapsule, nullptr);
+			if (!self) {
+				return nullptr;
 			}
-			const auto value = ValueFromObject<T>(attrObject);
-			// ValueFromObject set error. e.g. TypeError
-			Py_DECREF(attrObject);
-			return value;
+			PyObject* const function = PyCFunction_NewEx(&def, self, moduleName);
+			Py_DECREF(self);
+			return function;
+		}
+
+		// Scalars and functions are passed by value, everything else is allocated in ArgsScope storage
+		bool UsesArgsStorage(const Property& paramType) {
+			if (paramType.IsRef()) {
+				return true;
+			}
+			switch (paramType.GetType()) {
+			case ValueType::Bool:
+			case ValueType::Char8:
+			case ValueType::Char16:
+			case ValueType::Int8:
+			case ValueType::Int16:
+			case ValueType::Int32:
+			case ValueType::Int64:
+			case ValueType::UInt8:
+			case ValueType::UInt16:
+			case ValueType::UInt32:
+			case ValueType::UInt64:
+			case ValueType::Pointer:
+			case ValueType::Float:
+			case ValueType::Double:
+			case ValueType::Function:
+				return false;
+			default:
+				return true;
+			}
+		}
+
+		std::unique_ptr<ExternalCallPlan> CreateExternalCallPlan(const Method& method, MemAddr callAddr) {
+			auto plan = std::make_unique<ExternalCallPlan>();
+			const Property& retType = method.GetRetType();
+			plan->method = &method;
+			plan->func = callAddr.RCast<JitCall::CallingFunc>();
+			plan->returnToObjectFunc = GetReturnToObjectFunc(retType);
+			plan->hasHiddenParam = ValueUtils::IsHiddenParam(retType.GetType());
+			plan->beginCallFunc = plan->hasHiddenParam ? GetBeginCallFunc(retType) : nullptr;
+
+			const auto& paramTypes = method.GetParamTypes();
+			plan->pushParamFuncs.reserve(paramTypes.size());
+			size_t storageIndex = plan->hasHiddenParam;
+			for (size_t index = 0; index < paramTypes.size(); ++index) {
+				const Property& paramType = paramTypes[index];
+				if (paramType.IsRef()) {
+					plan->pushParamFuncs.push_back(GetPushRefParamFunc(paramType));
+					plan->refParams.push_back({ index, storageIndex, GetStoreValueFunc(paramType) });
+				} else {
+					plan->pushParamFuncs.push_back(GetPushParamFunc(paramType));
+				}
+				if (UsesArgsStorage(paramType)) {
+					++storageIndex;
+				}
+			}
+			return plan;
+		}
+
+		// Key of the JIT call cache next to the target address, the same address may be exported with another prototype
+		std::string GetJitSignature(const Method& method) {
+			const auto& paramTypes = method.GetParamTypes();
+			std::string signature;
+			signature.reserve(paramTypes.size() + 2);
+			signature.push_back(static_cast<char>(method.GetRetType().GetType()));
+			signature.push_back(static_cast<char>(method.GetVarIndex()));
+			for (const auto& paramType : paramTypes) {
+				signature.push_back(static_cast<char>(static_cast<uint8_t>(paramType.GetType()) | (paramType.IsRef() ? 0x80 : 0x00)));
+			}
+			return signature;
+		}
+
+		// Methods and enums a module may expose, materialised by its __getattr__ (PEP 562) on first access
+		struct LazyAttributes {
+			PyObject* moduleDict;
+			std::unordered_map<std::string, const EnumObject*> enums;
+			std::unordered_map<std::string, std::pair<const Method*, MemAddr>> methods;
+			size_t methodCount{};
+			size_t materializedCount{};
+			std::shared_mutex mutex{}; // every field above but moduleDict, filled by OnMethodExport while other threads look up
+		};
+
+		constexpr const char* kLazyAttributesCapsule = "plugify.LazyAttributes";
+
+		PyObject* LazyGetAttr(PyObject* self, PyObject* name) {
+			auto* const lazy = static_cast<LazyAttributes*>(PyCapsule_GetPointer(self, kLazyAttributesCapsule));
+			if (!lazy) {
+				return nullptr;
+			}
+			if (!PyUnicode_Check(name)) {
+				PyErr_Format(PyExc_AttributeError, "module has no attribute '%S'", name);
+				return nullptr;
+			}
+			const std::string key(PyUnicode_AsString(name));
+
+			std::optional<std::pair<const Method*, MemAddr>> entry;
+			const EnumObject* enumerator = nullptr;
+			{
+				ReadLock lock(lazy->mutex);
+				if (const auto it = lazy->methods.find(key); it != lazy->methods.end()) {
+					entry = it->second;
+				} else if (const auto enumIt = lazy->enums.find(key); enumIt != lazy->enums.end()) {
+					enumerator = enumIt->second;
+				}
+			}
+
+			PyObject* object;
+			if (entry) {
+				const auto [method, addr] = *entry;
+				PyObject* const moduleName = GetDictItemRef(lazy->moduleDict, "__name__");
+				object = g_py3lm.CreateExternalFunctionObject(*method, addr, method->GetName().c_str(), moduleName);
+				Py_XDECREF(moduleName);
+				if (!object) {
+					return nullptr;
+				}
+				// A thread which lost the race returns its own object, the dict keeps the last one stored
+				WriteLock lock(lazy->mutex);
+				if (lazy->methods.erase(key) != 0) {
+					++lazy->materializedCount;
+				}
+			} else if (enumerator) {
+				object = g_py3lm.GetEnumClass(*enumerator);
+				if (!object) {
+					if (!PyErr_Occurred()) {
+						PyErr_Format(PyExc_AttributeError, "enum '%U' has no values", name);
+					}
+					return nullptr;
+				}
+				Py_INCREF(object);
+			} else {
+				PyErr_Format(PyExc_AttributeError, "module has no attribute '%U'", name);
+				return nullptr;
+			}
+
+			// Later lookups find the object in the dict and skip __getattr__
+			if (PyDict_SetItem(lazy->moduleDict, name, object) < 0) {
+				Py_DECREF(object);
+				return nullptr;
+			}
+			return object;
+		}
+
+		PyMethodDef lazyGetAttrDef = { "__getattr__", &LazyGetAttr, METH_O, nullptr };
+
+		LazyAttributes* FindLazyAttributes(PyObject* moduleDict) {
+			PyObject* const getAttr = GetDictItemRef(moduleDict, "__getattr__");
+			LazyAttributes* lazy = nullptr;
+			if (getAttr && PyCFunction_Check(getAttr) && PyCFunction_GET_FUNCTION(getAttr) == &LazyGetAttr) {
+				lazy = static_cast<LazyAttributes*>(PyCapsule_GetPointer(PyCFunction_GET_SELF(getAttr), kLazyAttributesCapsule));
+			}
+			Py_XDECREF(getAttr);
+			return lazy;
+		}
+
+		// Returns nullptr when the module has its own __getattr__
+		LazyAttributes* GetOrCreateLazyAttributes(PyObject* moduleDict) {
+			if (HasDictItem(moduleDict, "__getattr__")) {
+				return FindLazyAttributes(moduleDict);
+			}
+
+			// Capsule owns the table and lives as long as the __getattr__ function
+			auto* const lazy = new LazyAttributes{ moduleDict, {}, {} };
+			PyObject* const capsule = PyCapsule_New(lazy, kLazyAttributesCapsule, [](PyObject* object) {
+				delete static_cast<LazyAttributes*>(PyCapsule_GetPointer(object, kLazyAttributesCapsule));
+			});
+			if (!capsule) {
+				delete lazy;
+				PyErr_Clear();
+				return nullptr;
+			}
+			PyObject* const getAttr = PyCFunction_New(&lazyGetAttrDef, capsule);
+			Py_DECREF(capsule);
+			if (!getAttr || PyDict_SetItemString(moduleDict, "__getattr__", getAttr) < 0) {
+				Py_XDECREF(getAttr);
+				PyErr_Clear();
+				return nullptr;
+			}
+			Py_DECREF(getAttr);
+			return lazy;
+		}
+
+		// Star imports see the lazy names too, each one is materialised by the import
+		bool SetLazyAll(PyObject* moduleDict, LazyAttributes& lazy) {
+			if (HasDictItem(moduleDict, "__all__")) {
+				return true;
+			}
+			std::vector<std::string> names;
+			{
+				ReadLock lock(lazy.mutex);
+				names.reserve(lazy.methods.size() + lazy.enums.size());
+				for (const auto& [name, _] : lazy.methods) {
+					names.push_back(name);
+				}
+				for (const auto& [name, _] : lazy.enums) {
+					names.push_back(name);
+				}
+			}
+			PyObject* const all = PyList_New(0);
+			if (!all) {
+				return false;
+			}
+			bool added = true;
+			for (const auto& name : names) {
+				PyObject* const nameObject = PyUnicode_FromStringView(name);
+				added = added && nameObject && PyList_Append(all, nameObject) == 0;
+				Py_XDECREF(nameObject);
+			}
+			added = added && PyDict_SetItemString(moduleDict, "__all__", all) == 0;
+			Py_DECREF(all);
+			return added;
+		}
+
+		void GenerateEnum(const Method& method, PyObject* moduleDict);
+
+		void GenerateEnum(const Property& paramType, PyObject* moduleDict) {
+			if (const auto* prototype = paramType.GetPrototype()) {
+				GenerateEnum(*prototype, moduleDict);
+			}
+			if (const auto* enumerator = paramType.GetEnumerate()) {
+				g_py3lm.BindEnumObject(*enumerator, moduleDict);
+			}
+		}
+
+		void GenerateEnum(const Method& method, PyObject* moduleDict) {
+			GenerateEnum(method.GetRetType(), moduleDict);
+			for (const auto& paramType : method.GetParamTypes()) {
+				GenerateEnum(paramType, moduleDict);
+			}
+		}
+
+		// Native Vector2/Vector3/Vector4/Matrix4x4 types, registered as builtin '_plugify' module
+		// and re-exported by plugify.plugin. Values are stored inline, so marshalling is a plain struct copy.
+		// The instance dict is created on first attribute assignment, as on the former python classes,
+		// and is visited by the cyclic GC so cycles through attributes are still collected.
+
+		template<typename T>
+		struct ValueObject {
+			PyObject_HEAD
+			T value;
+			PyObject* dict;
+		};
+
+		template<typename T>
+		using ValueComponents = std::array<float, sizeof(T) / sizeof(float)>;
+
+		template<typename T>
+		constexpr const char* kValueTypeName = nullptr;
+		template<>
+		constexpr const char* kValueTypeName<plg::vec2> = "Vector2";
+		template<>
+		constexpr const char* kValueTypeName<plg::vec3> = "Vector3";
+		template<>
+		constexpr const char* kValueTypeName<plg::vec4> = "Vector4";
+		template<>
+		constexpr const char* kValueTypeName<plg::mat4x4> = "Matrix4x4";
+
+		// Index of the type in InterpreterState::valueTypes and valueFreeLists
+		template<typename T>
+		constexpr size_t kValueTypeIndex = 0;
+		template<>
+		constexpr size_t kValueTypeIndex<plg::vec3> = 1;
+		template<>
+		constexpr size_t kValueTypeIndex<plg::vec4> = 2;
+		template<>
+		constexpr size_t kValueTypeIndex<plg::mat4x4> = 3;
+
+		constexpr size_t kMaxValueFreeListSize = 256;
+
+		template<typename T>
+		PyTypeObject* GetValueObjectType() {
+			return g_py3lm.GetState().valueTypes[kValueTypeIndex<T>];
+		}
+
+		template<typename T>
+		bool IsValueObject(PyObject* object) {
+			PyTypeObject* const type = GetValueObjectType<T>();
+			return type && (Py_IS_TYPE(object, type) || PyObject_TypeCheck(object, type));
+		}
+
+		// Free lists belong to the interpreter, its object allocator is not shared with others
+		template<typename T>
+		PyObject* AllocValueObject(PyTypeObject* type) {
+#ifndef Py_GIL_DISABLED
+			InterpreterState& state = g_py3lm.GetState();
+			auto& freeList = state.valueFreeLists[kValueTypeIndex<T>];
+			if (type == state.valueTypes[kValueTypeIndex<T>] && !freeList.empty()) {
+				PyObject* const object = freeList.back();
+				freeList.pop_back();
+				PyObject_Init(object, type);
+				// Untracked while it sat in the free list
+				PyObject_GC_Track(object);
+				return object;
+			}
+#endif
+			return type->tp_alloc(type, 0);
+		}
+
+		template<typename T>
+		int TraverseValueObject(PyObject* self, visitproc visit, void* arg) {
+			Py_VISIT(reinterpret_cast<ValueObject<T>*>(self)->dict);
+			// Heap type instances own a reference to their type
+			Py_VISIT(Py_TYPE(self));
+			return 0;
+		}
+
+		template<typename T>
+		int ClearValueObject(PyObject* self) {
+			Py_CLEAR(reinterpret_cast<ValueObject<T>*>(self)->dict);
+			return 0;
+		}
+
+		template<typename T>
+		void DeallocValueObject(PyObject* self) {
+			PyTypeObject* const type = Py_TYPE(self);
+			PyObject_GC_UnTrack(self);
+			Py_CLEAR(reinterpret_cast<ValueObject<T>*>(self)->dict);
+#ifdef Py_GIL_DISABLED
+			// Free-threaded allocators already keep per-thread pages, a shared list would only add contention
+			type->tp_free(self);
+#else
+			InterpreterState& state = g_py3lm.GetState();
+			auto& freeList = state.valueFreeLists[kValueTypeIndex<T>];
+			if (type == state.valueTypes[kValueTypeIndex<T>] && freeList.size() < kMaxValueFreeListSize) {
+				freeList.push_back(self);
+			} else {
+				type->tp_free(self);
+			}
+#endif
+			// Heap type instances own a reference to their type
+			Py_DECREF(type);
+		}
+
+		template<typename T>
+		PyObject* CreateValueObject(const T& value) {
+			PyTypeObject* const type = GetValueObjectType<T>();
+			if (!type) {
+				PyErr_SetString(PyExc_RuntimeError, "Native value type is not initialized");
+				return nullptr;
+			}
+			PyObject* const object = AllocValueObject<T>(type);
+			if (object) {
+				reinterpret_cast<ValueObject<T>*>(object)->value = value;
+			}
+			return object;
+		}
+
+		template<typename T>
+		std::optional<T> ValueFromValueObject(PyObject* object) {
+			if (IsValueObject<T>(object)) {
+				return reinterpret_cast<ValueObject<T>*>(object)->value;
+			}
+			SetTypeError(std::format("Expected {}", kValueTypeName<T>), object);
+			return std::nullopt;
+		}
+
+		template<typename T>
+		ValueComponents<T> GetValueComponents(PyObject* object) {
+			static_assert(sizeof(T) == sizeof(ValueComponents<T>));
+			return std::bit_cast<ValueComponents<T>>(reinterpret_cast<ValueObject<T>*>(object)->value);
+		}
+
+		template<typename T>
+		PyObject* CreateValueObject(const ValueComponents<T>& components) {
+			return CreateValueObject<T>(std::bit_cast<T>(components));
+		}
+
+		bool IsScalarObject(PyObject* object) {
+			return PyFloat_Check(object) || PyLong_Check(object);
+		}
+
+		void AppendFloatRepr(std::string& out, float value) {
+			std::array<char, 32> buffer{};
+			const auto [ptr, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+			const std::string_view str(buffer.data(), ec == std::errc{} ? ptr : buffer.data());
+			out += str;
+			// Keep python float repr, e.g. 1.0 instead of 1
+			if (str.find_first_of(".en") == std::string_view::npos) {
+				out += ".0";
+			}
+		}
+
+		float AddFloat(float a, float b) { return a + b; }
+		float SubFloat(float a, float b) { return a - b; }
+		float MulFloat(float a, float b) { return a * b; }
+		float DivFloat(float a, float b) { return a / b; }
+
+		template<typename T>
+		PyObject* ValueObjectComponentsOp(PyObject* left, PyObject* right, float (*op)(float, float), const char* verb) {
+			if (!IsValueObject<T>(left)) {
+				Py_RETURN_NOTIMPLEMENTED;
+			}
+			if (!IsValueObject<T>(right)) {
+				PyErr_Format(PyExc_ValueError, "Can only %s another %s", verb, kValueTypeName<T>);
+				return nullptr;
+			}
+			ValueComponents<T> result = GetValueComponents<T>(left);
+			const ValueComponents<T> other = GetValueComponents<T>(right);
+			for (size_t i = 0; i < result.size(); ++i) {
+				result[i] = op(result[i], other[i]);
+			}
+			return CreateValueObject<T>(result);
+		}
+
+		template<typename T>
+		PyObject* ValueObjectScalarOp(PyObject* left, PyObject* right, float (*op)(float, float)) {
+			const auto scalar = static_cast<float>(PyFloat_AsDouble(right));
+			if (PyErr_Occurred()) {
+				return nullptr;
+			}
+			ValueComponents<T> result = GetValueComponents<T>(left);
+			for (float& component : result) {
+				component = op(component, scalar);
+			}
+			return CreateValueObject<T>(result);
+		}
+
+		template<typename T>
+		PyObject* ValueObjectAdd(PyObject* left, PyObject* right) {
+			return ValueObjectComponentsOp<T>(left, right, &AddFloat, "add");
+		}
+
+		template<typename T>
+		PyObject* ValueObjectSubtract(PyObject* left, PyObject* right) {
+			return ValueObjectComponentsOp<T>(left, right, &SubFloat, "subtract");
+		}
+
+		template<typename T>
+		PyObject* ValueObjectMultiply(PyObject* left, PyObject* right) {
+			if (!IsValueObject<T>(left)) {
+				Py_RETURN_NOTIMPLEMENTED;
+			}
+			if (!IsScalarObject(right)) {
+				PyErr_SetString(PyExc_ValueError, "Can only multiply by a scalar");
+				return nullptr;
+			}
+			return ValueObjectScalarOp<T>(left, right, &MulFloat);
+		}
+
+		template<typename T>
+		PyObject* ValueObjectTrueDivide(PyObject* left, PyObject* right) {
+			if (!IsValueObject<T>(left)) {
+				Py_RETURN_NOTIMPLEMENTED;
+			}
+			if (!IsScalarObject(right)) {
+				PyErr_SetString(PyExc_ValueError, "Can only divide by a scalar");
+				return nullptr;
+			}
+			if (PyObject_Not(right) == 1) {
+				PyErr_SetString(PyExc_ZeroDivisionError, "float division by zero");
+				return nullptr;
+			}
+			return ValueObjectScalarOp<T>(left, right, &DivFloat);
+		}
+
+		template<typename T>
+		PyObject* VectorRepr(PyObject* self) {
+			std::string repr(kValueTypeName<T>);
+			repr += '(';
+			bool first = true;
+			for (const float component : GetValueComponents<T>(self)) {
+				if (!first) {
+					repr += ", ";
+				}
+				AppendFloatRepr(repr, component);
+				first = false;
+			}
+			repr += ')';
+			return PyUnicode_FromStringAndSize(repr.data(), static_cast<Py_ssize_t>(repr.size()));
+		}
+
+		template<typename T>
+		PyObject* VectorNew(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+			ValueComponents<T> components{};
+			bool parsed;
+			if constexpr (components.size() == 2) {
+				static std::array kwlist = { const_cast<char*>("x"), const_cast<char*>("y"), static_cast<char*>(nullptr) };
+				parsed = PyArg_ParseTupleAndKeywords(args, kwargs, "|ff", kwlist.data(), &components[0], &components[1]);
+			} else if constexpr (components.size() == 3) {
+				static std::array kwlist = { const_cast<char*>("x"), const_cast<char*>("y"), const_cast<char*>("z"), static_cast<char*>(nullptr) };
+				parsed = PyArg_ParseTupleAndKeywords(args, kwargs, "|fff", kwlist.data(), &components[0], &components[1], &components[2]);
+			} else {
+				static std::array kwlist = { const_cast<char*>("x"), const_cast<char*>("y"), const_cast<char*>("z"), const_cast<char*>("w"), static_cast<char*>(nullptr) };
+				parsed = PyArg_ParseTupleAndKeywords(args, kwargs, "|ffff", kwlist.data(), &components[0], &components[1], &components[2], &components[3]);
+			}
+			if (!parsed) {
+				return nullptr;
+			}
+			PyObject* const object = AllocValueObject<T>(type);
+			if (object) {
+				reinterpret_cast<ValueObject<T>*>(object)->value = std::bit_cast<T>(components);
+			}
+			return object;
+		}
+
+		template<typename T>
+		PyObject* VectorReduce(PyObject* self, [[maybe_unused]] PyObject* args) {
+			const ValueComponents<T> components = GetValueComponents<T>(self);
+			PyObject* const argsObject = PyTuple_New(static_cast<Py_ssize_t>(components.size()));
+			if (!argsObject) {
+				return nullptr;
+			}
+			for (size_t i = 0; i < components.size(); ++i) {
+				PyObject* const valueObject = PyFloat_FromDouble(static_cast<double>(components[i]));
+				if (!valueObject) {
+					Py_DECREF(argsObject);
+					return nullptr;
+				}
+				PyTuple_SET_ITEM(argsObject, static_cast<Py_ssize_t>(i), valueObject); // valueObject ref taken by tuple
+			}
+			return Py_BuildValue("(ON)", reinterpret_cast<PyObject*>(Py_TYPE(self)), argsObject);
+		}
+
+		template<typename T>
+		PyType_Spec* GetVectorTypeSpec() {
+			static std::array<PyMemberDef, 6> members = [] {
+				constexpr std::array memberNames = { "x", "y", "z", "w" };
+				constexpr size_t count = std::tuple_size_v<ValueComponents<T>>;
+				std::array<PyMemberDef, 6> result{};
+				for (size_t i = 0; i < count; ++i) {
+					result[i] = { memberNames[i], Py_T_FLOAT, static_cast<Py_ssize_t>(offsetof(ValueObject<T>, value) + i * sizeof(float)), 0, nullptr };
+				}
+				result[count] = { "__dictoffset__", Py_T_PYSSIZET, static_cast<Py_ssize_t>(offsetof(ValueObject<T>, dict)), Py_READONLY, nullptr };
+				return result;
+			}();
+			static std::array methods = {
+				PyMethodDef{ "__reduce__", &VectorReduce<T>, METH_NOARGS, nullptr },
+				PyMethodDef{ nullptr, nullptr, 0, nullptr }
+			};
+			static std::array slots = {
+				PyType_Slot{ Py_tp_new, reinterpret_cast<void*>(&VectorNew<T>) },
+				PyType_Slot{ Py_tp_dealloc, reinterpret_cast<void*>(&DeallocValueObject<T>) },
+				PyType_Slot{ Py_tp_traverse, reinterpret_cast<void*>(&TraverseValueObject<T>) },
+				PyType_Slot{ Py_tp_clear, reinterpret_cast<void*>(&ClearValueObject<T>) },
+				PyType_Slot{ Py_tp_repr, reinterpret_cast<void*>(&VectorRepr<T>) },
+				PyType_Slot{ Py_tp_members, members.data() },
+				PyType_Slot{ Py_tp_methods, methods.data() },
+				PyType_Slot{ Py_nb_add, reinterpret_cast<void*>(&ValueObjectAdd<T>) },
+				PyType_Slot{ Py_nb_subtract, reinterpret_cast<void*>(&ValueObjectSubtract<T>) },
+				PyType_Slot{ Py_nb_multiply, reinterpret_cast<void*>(&ValueObjectMultiply<T>) },
+				PyType_Slot{ Py_nb_true_divide, reinterpret_cast<void*>(&ValueObjectTrueDivide<T>) },
+				PyType_Slot{ 0, nullptr }
+			};
+			static const std::string name(std::format("plugify.plugin.{}", kValueTypeName<T>));
+			static PyType_Spec spec = { name.c_str(), static_cast<int>(sizeof(ValueObject<T>)), 0, Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC, slots.data() };
+			return &spec;
+		}
+
+		constexpr const char* kMatrixElementsError = "Elements must be a 4x4 or 1x16 list";
+
+		// Live view of Matrix4x4.m, so mat.m[i][j] = v and mat.m[i] = row write through to the inline
+		// storage as they did on the former list of lists. The view of all rows (row < 0) yields row views.
+		struct MatrixViewObject {
+			PyObject_HEAD
+			PyObject* matrix;
+			Py_ssize_t row;
+		};
+
+		bool IsMatrixViewObject(PyObject* object) {
+			PyTypeObject* const matrixViewType = g_py3lm.GetState().matrixViewType;
+			return matrixViewType && Py_IS_TYPE(object, matrixViewType);
+		}
+
+		plg::mat4x4& GetViewMatrix(PyObject* self) {
+			return reinterpret_cast<ValueObject<plg::mat4x4>*>(reinterpret_cast<MatrixViewObject*>(self)->matrix)->value;
+		}
+
+		bool MatrixFromListObject(PyObject* object, plg::mat4x4& matrix) {
+			if (IsMatrixViewObject(object) && reinterpret_cast<MatrixViewObject*>(object)->row < 0) {
+				matrix = GetViewMatrix(object);
+				return true;
+			}
+			if (!PyList_Check(object)) {
+				PyErr_SetString(PyExc_ValueError, kMatrixElementsError);
+				return false;
+			}
+			const Py_ssize_t size = PyList_GET_SIZE(object);
+			if (size == Py_ssize_t{ 16 }) {
+				for (Py_ssize_t i = 0; i < size; ++i) {
+					const ListItem item(object, i);
+					const double value = item.get() ? PyFloat_AsDouble(item.get()) : -1.0;
+					if (PyErr_Occurred()) {
+						return false;
+					}
+					matrix.data[static_cast<size_t>(i)] = static_cast<float>(value);
+				}
+				return true;
+			}
+			if (size != Py_ssize_t{ 4 }) {
+				PyErr_SetString(PyExc_ValueError, kMatrixElementsError);
+				return false;
+			}
+			for (Py_ssize_t i = 0; i < Py_ssize_t{ 4 }; ++i) {
+				const ListItem rowItem(object, i);
+				PyObject* const rowObject = rowItem.get();
+				if (!rowObject) {
+					return false;
+				}
+				if (IsMatrixViewObject(rowObject) && reinterpret_cast<MatrixViewObject*>(rowObject)->row >= 0) {
+					const auto row = static_cast<size_t>(reinterpret_cast<MatrixViewObject*>(rowObject)->row);
+					std::memcpy(&matrix.data[static_cast<size_t>(i) * 4], &GetViewMatrix(rowObject).data[row * 4], 4 * sizeof(float));
+					continue;
+				}
+				if (!PyList_Check(rowObject) || PyList_GET_SIZE(rowObject) != Py_ssize_t{ 4 }) {
+					PyErr_SetString(PyExc_ValueError, kMatrixElementsError);
+					return false;
+				}
+				for (Py_ssize_t j = 0; j < Py_ssize_t{ 4 }; ++j) {
+					const ListItem item(rowObject, j);
+					const double value = item.get() ? PyFloat_AsDouble(item.get()) : -1.0;
+					if (PyErr_Occurred()) {
+						return false;
+					}
+					matrix.data[static_cast<size_t>(i * Py_ssize_t{ 4 } + j)] = static_cast<float>(value);
+				}
+			}
+			return true;
+		}
+
+		PyObject* MatrixRowObject(const plg::mat4x4& matrix, Py_ssize_t row) {
+			PyObject* const rowObject = PyList_New(Py_ssize_t{ 4 });
+			if (!rowObject) {
+				return nullptr;
+			}
+			for (Py_ssize_t j = 0; j < Py_ssize_t{ 4 }; ++j) {
+				PyObject* const mObject = PyFloat_FromDouble(static_cast<double>(matrix.data[static_cast<size_t>(row * Py_ssize_t{ 4 } + j)]));
+				if (!mObject) {
+					Py_DECREF(rowObject);
+					return nullptr;
+				}
+				PyList_SET_ITEM(rowObject, j, mObject); // mObject ref taken by list
+			}
+			return rowObject;
+		}
+
+		PyObject* MatrixRowsObject(const plg::mat4x4& matrix) {
+			PyObject* const rowsObject = PyList_New(Py_ssize_t{ 4 });
+			if (!rowsObject) {
+				return nullptr;
+			}
+			for (Py_ssize_t i = 0; i < Py_ssize_t{ 4 }; ++i) {
+				PyObject* const rowObject = MatrixRowObject(matrix, i);
+				if (!rowObject) {
+					Py_DECREF(rowsObject);
+					return nullptr;
+				}
+				PyList_SET_ITEM(rowsObject, i, rowObject); // rowObject ref taken by list
+			}
+			return rowsObject;
+		}
+
+		PyObject* CreateMatrixViewObject(PyObject* matrix, Py_ssize_t row) {
+			PyTypeObject* const matrixViewType = g_py3lm.GetState().matrixViewType;
+			if (!matrixViewType) {
+				PyErr_SetString(PyExc_RuntimeError, "Native matrix view type is not initialized");
+				return nullptr;
+			}
+			auto* const view = PyObject_GC_New(MatrixViewObject, matrixViewType);
+			if (view) {
+				view->matrix = Py_NewRef(matrix);
+				view->row = row;
+				PyObject_GC_Track(view);
+			}
+			return reinterpret_cast<PyObject*>(view);
+		}
+
+		PyObject* MatrixViewToList(PyObject* self, [[maybe_unused]] PyObject* args) {
+			const Py_ssize_t row = reinterpret_cast<MatrixViewObject*>(self)->row;
+			return row < 0 ? MatrixRowsObject(GetViewMatrix(self)) : MatrixRowObject(GetViewMatrix(self), row);
+		}
+
+		Py_ssize_t MatrixViewLength([[maybe_unused]] PyObject* self) {
+			return Py_ssize_t{ 4 };
+		}
+
+		PyObject* MatrixViewItem(PyObject* self, Py_ssize_t index) {
+			if (index < 0 || index >= Py_ssize_t{ 4 }) {
+				PyErr_SetString(PyExc_IndexError, "matrix index out of range");
+				return nullptr;
+			}
+			const auto* const view = reinterpret_cast<MatrixViewObject*>(self);
+			if (view->row < 0) {
+				return CreateMatrixViewObject(view->matrix, index);
+			}
+			return PyFloat_FromDouble(static_cast<double>(GetViewMatrix(self).data[static_cast<size_t>(view->row * Py_ssize_t{ 4 } + index)]));
+		}
+
+		PyObject* MatrixViewSubscript(PyObject* self, PyObject* key) {
+			if (PyIndex_Check(key)) {
+				Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+				if (index == -1 && PyErr_Occurred()) {
+					return nullptr;
+				}
+				if (index < 0) {
+					index += Py_ssize_t{ 4 };
+				}
+				return MatrixViewItem(self, index);
+			}
+			if (PySlice_Check(key)) {
+				// Slices are copies, as they were on lists
+				PyObject* const listObject = MatrixViewToList(self, nullptr);
+				if (!listObject) {
+					return nullptr;
+				}
+				PyObject* const result = PyObject_GetItem(listObject, key);
+				Py_DECREF(listObject);
+				return result;
+			}
+			SetTypeError("Matrix indices must be integers or slices", key);
+			return nullptr;
+		}
+
+		bool MatrixRowFromObject(PyObject* object, std::array<float, 4>& row) {
+			if (IsMatrixViewObject(object) && reinterpret_cast<MatrixViewObject*>(object)->row >= 0) {
+				const auto index = static_cast<size_t>(reinterpret_cast<MatrixViewObject*>(object)->row);
+				std::memcpy(row.data(), &GetViewMatrix(object).data[index * 4], sizeof(row));
+				return true;
+			}
+			PyObject* const sequence = SequenceFast(object, "Matrix row must be a sequence of 4 floats");
+			if (!sequence) {
+				return false;
+			}
+			if (PySequence_Fast_GET_SIZE(sequence) != Py_ssize_t{ 4 }) {
+				Py_DECREF(sequence);
+				PyErr_SetString(PyExc_ValueError, "Matrix row must be a sequence of 4 floats");
+				return false;
+			}
+			for (Py_ssize_t j = 0; j < Py_ssize_t{ 4 }; ++j) {
+				const double value = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(sequence, j));
+				if (PyErr_Occurred()) {
+					Py_DECREF(sequence);
+					return false;
+				}
+				row[static_cast<size_t>(j)] = static_cast<float>(value);
+			}
+			Py_DECREF(sequence);
+			return true;
+		}
+
+		int MatrixViewAssSubscript(PyObject* self, PyObject* key, PyObject* valueObject) {
+			if (!valueObject) {
+				PyErr_SetString(PyExc_TypeError, "Cannot delete matrix elements");
+				return -1;
+			}
+			if (!PyIndex_Check(key)) {
+				SetTypeError("Matrix indices must be integers", key);
+				return -1;
+			}
+			Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+			if (index == -1 && PyErr_Occurred()) {
+				return -1;
+			}
+			if (index < 0) {
+				index += Py_ssize_t{ 4 };
+			}
+			if (index < 0 || index >= Py_ssize_t{ 4 }) {
+				PyErr_SetString(PyExc_IndexError, "matrix assignment index out of range");
+				return -1;
+			}
+			plg::mat4x4& matrix = GetViewMatrix(self);
+			const Py_ssize_t row = reinterpret_cast<MatrixViewObject*>(self)->row;
+			if (row < 0) {
+				std::array<float, 4> values{};
+				if (!MatrixRowFromObject(valueObject, values)) {
+					return -1;
+				}
+				std::memcpy(&matrix.data[static_cast<size_t>(index) * 4], values.data(), sizeof(values));
+				return 0;
+			}
+			const double value = PyFloat_AsDouble(valueObject);
+			if (PyErr_Occurred()) {
+				return -1;
+			}
+			matrix.data[static_cast<size_t>(row * Py_ssize_t{ 4 } + index)] = static_cast<float>(value);
+			return 0;
+		}
+
+		PyObject* MatrixViewRepr(PyObject* self) {
+			PyObject* const listObject = MatrixViewToList(self, nullptr);
+			if (!listObject) {
+				return nullptr;
+			}
+			PyObject* const result = PyObject_Repr(listObject);
+			Py_DECREF(listObject);
+			return result;
+		}
+
+		// Compares as the list it replaced, mat.m == [[...], ...] keeps working
+		PyObject* MatrixViewRichCompare(PyObject* self, PyObject* other, int op) {
+			PyObject* const listObject = MatrixViewToList(self, nullptr);
+			if (!listObject) {
+				return nullptr;
+			}
+			PyObject* const result = PyObject_RichCompare(listObject, other, op);
+			Py_DECREF(listObject);
+			return result;
+		}
+
+		void DeallocMatrixView(PyObject* self) {
+			PyTypeObject* const type = Py_TYPE(self);
+			PyObject_GC_UnTrack(self);
+			Py_DECREF(reinterpret_cast<MatrixViewObject*>(self)->matrix);
+			PyObject_GC_Del(self);
+			Py_DECREF(type);
+		}
+
+		// No tp_clear, a view keeps its matrix for life. Cycles through it are broken by clearing the matrix dict.
+		int TraverseMatrixView(PyObject* self, visitproc visit, void* arg) {
+			Py_VISIT(reinterpret_cast<MatrixViewObject*>(self)->matrix);
+			Py_VISIT(Py_TYPE(self));
+			return 0;
+		}
+
+		PyType_Spec* GetMatrixViewTypeSpec() {
+			static std::array methods = {
+				PyMethodDef{ "tolist", &MatrixViewToList, METH_NOARGS, nullptr },
+				PyMethodDef{ nullptr, nullptr, 0, nullptr }
+			};
+			static std::array slots = {
+				PyType_Slot{ Py_tp_dealloc, reinterpret_cast<void*>(&DeallocMatrixView) },
+				PyType_Slot{ Py_tp_traverse, reinterpret_cast<void*>(&TraverseMatrixView) },
+				PyType_Slot{ Py_tp_repr, reinterpret_cast<void*>(&MatrixViewRepr) },
+				PyType_Slot{ Py_tp_richcompare, reinterpret_cast<void*>(&MatrixViewRichCompare) },
+				PyType_Slot{ Py_tp_methods, methods.data() },
+				PyType_Slot{ Py_sq_length, reinterpret_cast<void*>(&MatrixViewLength) },
+				PyType_Slot{ Py_sq_item, reinterpret_cast<void*>(&MatrixViewItem) },
+				PyType_Slot{ Py_mp_length, reinterpret_cast<void*>(&MatrixViewLength) },
+				PyType_Slot{ Py_mp_subscript, reinterpret_cast<void*>(&MatrixViewSubscript) },
+				PyType_Slot{ Py_mp_ass_subscript, reinterpret_cast<void*>(&MatrixViewAssSubscript) },
+				PyType_Slot{ 0, nullptr }
+			};
+			static PyType_Spec spec = { "plugify.plugin.MatrixView", static_cast<int>(sizeof(MatrixViewObject)), 0, Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION | Py_TPFLAGS_SEQUENCE | Py_TPFLAGS_HAVE_GC, slots.data() };
+			return &spec;
+		}
+
+		plg::mat4x4 MatrixIdentity() {
+			plg::mat4x4 matrix{};
+			for (size_t i = 0; i < 4; ++i) {
+				matrix.data[i * 4 + i] = 1.0f;
+			}
+			return matrix;
+		}
+
+		const plg::mat4x4& GetMatrix(PyObject* object) {
+			return reinterpret_cast<ValueObject<plg::mat4x4>*>(object)->value;
+		}
+
+		PyObject* MatrixNew(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+			static std::array kwlist = { const_cast<char*>("m"), static_cast<char*>(nullptr) };
+			PyObject* elementsObject = Py_None;
+			if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwlist.data(), &elementsObject)) {
+				return nullptr;
+			}
+			plg::mat4x4 matrix = MatrixIdentity();
+			if (elementsObject != Py_None && !MatrixFromListObject(elementsObject, matrix)) {
+				return nullptr;
+			}
+			PyObject* const object = AllocValueObject<plg::mat4x4>(type);
+			if (object) {
+				reinterpret_cast<ValueObject<plg::mat4x4>*>(object)->value = matrix;
+			}
+			return object;
+		}
+
+		PyObject* MatrixGetElements(PyObject* self, [[maybe_unused]] void* closure) {
+			return CreateMatrixViewObject(self, -1);
+		}
+
+		int MatrixSetElements(PyObject* self, PyObject* value, [[maybe_unused]] void* closure) {
+			if (!value) {
+				PyErr_SetString(PyExc_AttributeError, "Cannot delete matrix elements");
+				return -1;
+			}
+			plg::mat4x4 matrix{};
+			if (!MatrixFromListObject(value, matrix)) {
+				return -1;
+			}
+			reinterpret_cast<ValueObject<plg::mat4x4>*>(self)->value = matrix;
+			return 0;
+		}
+
+		PyObject* MatrixMultiply(PyObject* left, PyObject* right) {
+			if (!IsValueObject<plg::mat4x4>(left)) {
+				Py_RETURN_NOTIMPLEMENTED;
+			}
+			if (IsValueObject<plg::mat4x4>(right)) {
+				const plg::mat4x4& a = GetMatrix(left);
+				const plg::mat4x4& b = GetMatrix(right);
+				plg::mat4x4 result{};
+				for (size_t i = 0; i < 4; ++i) {
+					for (size_t j = 0; j < 4; ++j) {
+						float sum = 0.0f;
+						for (size_t k = 0; k < 4; ++k) {
+							sum += a.data[i * 4 + k] * b.data[k * 4 + j];
+						}
+						result.data[i * 4 + j] = sum;
+					}
+				}
+				return CreateValueObject(result);
+			}
+			if (!IsScalarObject(right)) {
+				PyErr_SetString(PyExc_ValueError, "Can only multiply by another Matrix4x4 or a scalar");
+				return nullptr;
+			}
+			return ValueObjectScalarOp<plg::mat4x4>(left, right, &MulFloat);
+		}
+
+		PyObject* MatrixRepr(PyObject* self) {
+			const plg::mat4x4& matrix = GetMatrix(self);
+			std::string repr;
+			for (size_t i = 0; i < 4; ++i) {
+				std::format_to(std::back_inserter(repr), "{}Row {}: [", i ? "\n" : "", i);
+				for (size_t j = 0; j < 4; ++j) {
+					if (j) {
+						repr += ", ";
+					}
+					AppendFloatRepr(repr, matrix.data[i * 4 + j]);
+				}
+				repr += ']';
+			}
+			return PyUnicode_FromStringAndSize(repr.data(), static_cast<Py_ssize_t>(repr.size()));
+		}
+
+		PyObject* MatrixTranspose(PyObject* self, [[maybe_unused]] PyObject* args) {
+			const plg::mat4x4& matrix = GetMatrix(self);
+			plg::mat4x4 result{};
+			for (size_t i = 0; i < 4; ++i) {
+				for (size_t j = 0; j < 4; ++j) {
+					result.data[i * 4 + j] = matrix.data[j * 4 + i];
+				}
+			}
+			return CreateValueObject(result);
+		}
+
+		PyObject* MatrixToList(PyObject* self, [[maybe_unused]] PyObject* args) {
+			return MatrixRowsObject(GetMatrix(self));
+		}
+
+		PyObject* MatrixReduce(PyObject* self, [[maybe_unused]] PyObject* args) {
+			PyObject* const elementsObject = MatrixRowsObject(GetMatrix(self));
+			if (!elementsObject) {
+				return nullptr;
+			}
+			return Py_BuildValue("(O(N))", reinterpret_cast<PyObject*>(Py_TYPE(self)), elementsObject);
+		}
+
+		PyObject* MatrixIdentityObject([[maybe_unused]] PyObject* self, [[maybe_unused]] PyObject* args) {
+			return CreateValueObject(MatrixIdentity());
+		}
+
+		PyObject* MatrixZeroObject([[maybe_unused]] PyObject* self, [[maybe_unused]] PyObject* args) {
+			return CreateValueObject(plg::mat4x4{});
+		}
+
+		PyObject* MatrixFromList([[maybe_unused]] PyObject* self, PyObject* elementsObject) {
+			plg::mat4x4 matrix{};
+			if (!MatrixFromListObject(elementsObject, matrix)) {
+				return nullptr;
+			}
+			return CreateValueObject(matrix);
+		}
+
+		PyType_Spec* GetMatrixTypeSpec() {
+			static std::array getset = {
+				PyGetSetDef{ "m", &MatrixGetElements, &MatrixSetElements, nullptr, nullptr },
+				PyGetSetDef{ nullptr, nullptr, nullptr, nullptr, nullptr }
+			};
+			static std::array members = {
+				PyMemberDef{ "__dictoffset__", Py_T_PYSSIZET, static_cast<Py_ssize_t>(offsetof(ValueObject<plg::mat4x4>, dict)), Py_READONLY, nullptr },
+				PyMemberDef{ nullptr, 0, 0, 0, nullptr }
+			};
+			static std::array methods = {
+				PyMethodDef{ "transpose", &MatrixTranspose, METH_NOARGS, nullptr },
+				PyMethodDef{ "to_list", &MatrixToList, METH_NOARGS, nullptr },
+				PyMethodDef{ "__reduce__", &MatrixReduce, METH_NOARGS, nullptr },
+				PyMethodDef{ "identity", &MatrixIdentityObject, METH_NOARGS | METH_STATIC, nullptr },
+				PyMethodDef{ "zero", &MatrixZeroObject, METH_NOARGS | METH_STATIC, nullptr },
+				PyMethodDef{ "from_list", &MatrixFromList, METH_O | METH_STATIC, nullptr },
+				PyMethodDef{ nullptr, nullptr, 0, nullptr }
+			};
+			static std::array slots = {
+				PyType_Slot{ Py_tp_new, reinterpret_cast<void*>(&MatrixNew) },
+				PyType_Slot{ Py_tp_dealloc, reinterpret_cast<void*>(&DeallocValueObject<plg::mat4x4>) },
+				PyType_Slot{ Py_tp_traverse, reinterpret_cast<void*>(&TraverseValueObject<plg::mat4x4>) },
+				PyType_Slot{ Py_tp_clear, reinterpret_cast<void*>(&ClearValueObject<plg::mat4x4>) },
+				PyType_Slot{ Py_tp_repr, reinterpret_cast<void*>(&MatrixRepr) },
+				PyType_Slot{ Py_tp_getset, getset.data() },
+				PyType_Slot{ Py_tp_members, members.data() },
+				PyType_Slot{ Py_tp_methods, methods.data() },
+				PyType_Slot{ Py_nb_add, reinterpret_cast<void*>(&ValueObjectAdd<plg::mat4x4>) },
+				PyType_Slot{ Py_nb_subtract, reinterpret_cast<void*>(&ValueObjectSubtract<plg::mat4x4>) },
+				PyType_Slot{ Py_nb_multiply, reinterpret_cast<void*>(&MatrixMultiply) },
+				PyType_Slot{ Py_nb_true_divide, reinterpret_cast<void*>(&ValueObjectTrueDivide<plg::mat4x4>) },
+				PyType_Slot{ 0, nullptr }
+			};
+			static PyType_Spec spec = { "plugify.plugin.Matrix4x4", static_cast<int>(sizeof(ValueObject<plg::mat4x4>)), 0, Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC, slots.data() };
+			return &spec;
+		}
+
+		// Sequence over a borrowed plg::vector<T>, passed to exports marked with plugify.plugin.array_views
+		// instead of a list. It is valid only while InternalCall runs and raises ValueError once released.
+		// Views of ref params are writable and resizable, changes go straight to the caller's vector.
+
+		struct ArrayViewOps {
+			Py_ssize_t (*size)(const void* array);
+			PyObject* (*getItem)(const void* array, Py_ssize_t index);
+			const void* (*data)(const void* array);
+			bool (*setItem)(void* array, Py_ssize_t index, PyObject* valueObject);
+			bool (*append)(void* array, PyObject* valueObject);
+			void (*resize)(void* array, Py_ssize_t size);
+			const char* format; // struct format of the items or nullptr when buffer export is not supported
+			Py_ssize_t itemSize;
+		};
+
+		struct ArrayViewObject {
+			PyObject_HEAD
+			void* array;
+			const ArrayViewOps* ops;
+			bool writable;
+			void* snapshot; // private copy handed to buffer consumers, so exported buffers outlive the call
+			Py_ssize_t snapshotLength;
+			Py_ssize_t exports;
+		};
+
+		template<typename T>
+		constexpr const char* kBufferFormat = nullptr;
+		template<>
+		constexpr const char* kBufferFormat<int8_t> = "b";
+		template<>
+		constexpr const char* kBufferFormat<int16_t> = "h";
+		template<>
+		constexpr const char* kBufferFormat<int32_t> = "i";
+		template<>
+		constexpr const char* kBufferFormat<int64_t> = "q";
+		template<>
+		constexpr const char* kBufferFormat<uint8_t> = "B";
+		template<>
+		constexpr const char* kBufferFormat<uint16_t> = "H";
+		template<>
+		constexpr const char* kBufferFormat<uint32_t> = "I";
+		template<>
+		constexpr const char* kBufferFormat<uint64_t> = "Q";
+		template<>
+		constexpr const char* kBufferFormat<void*> = "P";
+		template<>
+		constexpr const char* kBufferFormat<float> = "f";
+		template<>
+		constexpr const char* kBufferFormat<double> = "d";
+
+		template<typename T>
+		PyObject* CreateArrayViewItem(const T& value) {
+			if constexpr (std::is_same_v<T, void*>) {
+				return PyLong_FromVoidPtr(value);
+			} else if constexpr (std::is_floating_point_v<T>) {
+				return PyFloat_FromDouble(static_cast<double>(value));
+			} else if constexpr (std::is_signed_v<T>) {
+				return PyLong_FromLongLong(static_cast<long long>(value));
+			} else if constexpr (std::is_unsigned_v<T>) {
+				return PyLong_FromUnsignedLongLong(static_cast<unsigned long long>(value));
+			} else {
+				return CreateValueObject(value);
+			}
+		}
+
+		template<typename T>
+		const ArrayViewOps* GetArrayViewOps() {
+			static const ArrayViewOps ops = {
+				[](const void* array) {
+					return static_cast<Py_ssize_t>(static_cast<const plg::vector<T>*>(array)->size());
+				},
+				[](const void* array, Py_ssize_t index) {
+					return CreateArrayViewItem<T>((*static_cast<const plg::vector<T>*>(array))[static_cast<size_t>(index)]);
+				},
+				[](const void* array) {
+					return static_cast<const void*>(static_cast<const plg::vector<T>*>(array)->data());
+				},
+				[](void* array, Py_ssize_t index, PyObject* valueObject) {
+					if (auto value = ValueFromObject<T>(valueObject)) {
+						(*static_cast<plg::vector<T>*>(array))[static_cast<size_t>(index)] = std::move(*value);
+						return true;
+					}
+					return false;
+				},
+				[](void* array, PyObject* valueObject) {
+					if (auto value = ValueFromObject<T>(valueObject)) {
+						static_cast<plg::vector<T>*>(array)->push_back(std::move(*value));
+						return true;
+					}
+					return false;
+				},
+				[](void* array, Py_ssize_t size) {
+					static_cast<plg::vector<T>*>(array)->resize(static_cast<size_t>(size));
+				},
+				kBufferFormat<T>,
+				static_cast<Py_ssize_t>(sizeof(T))
+			};
+			return &ops;
+		}
+
+		template<typename T>
+		PyObject* CreateArrayViewObject(plg::vector<T>* array, bool writable) {
+			PyTypeObject* const arrayViewType = g_py3lm.GetState().arrayViewType;
+			if (!arrayViewType) {
+				PyErr_SetString(PyExc_RuntimeError, "Native array view type is not initialized");
+				return nullptr;
+			}
+			auto* const view = PyObject_New(ArrayViewObject, arrayViewType);
+			if (view) {
+				view->array = array;
+				view->ops = GetArrayViewOps<T>();
+				view->writable = writable;
+				view->snapshot = nullptr;
+				view->snapshotLength = 0;
+				view->exports = 0;
+			}
+			return reinterpret_cast<PyObject*>(view);
+		}
+
+		template<typename T>
+		PyObject* CreateArrayViewObject(const plg::vector<T>& array) {
+			// Never written through, writable is false
+			return CreateArrayViewObject(const_cast<plg::vector<T>*>(&array), false);
+		}
+
+		template<typename T>
+		PyObject* CreateArrayViewObject(plg::vector<T>* array) {
+			return CreateArrayViewObject(array, true);
+		}
+
+		bool IsArrayViewObject(PyObject* object) {
+			PyTypeObject* const arrayViewType = g_py3lm.GetState().arrayViewType;
+			return arrayViewType && Py_IS_TYPE(object, arrayViewType);
+		}
+
+		template<typename T>
+		bool FillArrayFromArrayViewObject(PyObject* object, plg::vector<T>& array) {
+			const auto* const view = reinterpret_cast<ArrayViewObject*>(object);
+			if (view->array && view->ops == GetArrayViewOps<T>()) {
+				array = *static_cast<const plg::vector<T>*>(view->array);
+				return true;
+			}
+			return false;
+		}
+
+		void ReleaseArrayViews(PyObject* const* args, size_t count) {
+			PyTypeObject* const arrayViewType = g_py3lm.GetState().arrayViewType;
+			if (!arrayViewType) {
+				return;
+			}
+			for (size_t i = 0; i < count; ++i) {
+				PyObject* const item = args[i];
+				if (item && Py_IS_TYPE(item, arrayViewType)) {
+					reinterpret_cast<ArrayViewObject*>(item)->array = nullptr;
+				}
+			}
+		}
+
+		ArrayViewObject* GetValidArrayView(PyObject* self) {
+			auto* const view = reinterpret_cast<ArrayViewObject*>(self);
+			if (!view->array) {
+				PyErr_SetString(PyExc_ValueError, "Operation forbidden on released array view, it is only valid during the call");
+				return nullptr;
+			}
+			return view;
+		}
+
+		Py_ssize_t ArrayViewLength(PyObject* self) {
+			ArrayViewObject* const view = GetValidArrayView(self);
+			return view ? view->ops->size(view->array) : -1;
+		}
+
+		ArrayViewObject* GetWritableArrayView(PyObject* self) {
+			ArrayViewObject* const view = GetValidArrayView(self);
+			if (view && !view->writable) {
+				PyErr_SetString(PyExc_TypeError, "Array view is read-only, only ref params can be modified");
+				return nullptr;
+			}
+			return view;
+		}
+
+		PyObject* ArrayViewItem(PyObject* self, Py_ssize_t index) {
+			ArrayViewObject* const view = GetValidArrayView(self);
+			if (!view) {
+				return nullptr;
+			}
+			if (index < 0 || index >= view->ops->size(view->array)) {
+				PyErr_SetString(PyExc_IndexError, "array view index out of range");
+				return nullptr;
+			}
+			return view->ops->getItem(view->array, index);
+		}
+
+		PyObject* ArrayViewSlice(ArrayViewObject* view, Py_ssize_t start, Py_ssize_t step, Py_ssize_t length) {
+			PyObject* const listObject = PyList_New(length);
+			if (!listObject) {
+				return nullptr;
+			}
+			for (Py_ssize_t i = 0, index = start; i < length; ++i, index += step) {
+				PyObject* const valueObject = view->ops->getItem(view->array, index);
+				if (!valueObject) {
+					Py_DECREF(listObject);
+					return nullptr;
+				}
+				PyList_SET_ITEM(listObject, i, valueObject);
+			}
+			return listObject;
+		}
+
+		PyObject* ArrayViewSubscript(PyObject* self, PyObject* key) {
+			ArrayViewObject* const view = GetValidArrayView(self);
+			if (!view) {
+				return nullptr;
+			}
+			if (PyIndex_Check(key)) {
+				Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+				if (index == -1 && PyErr_Occurred()) {
+					return nullptr;
+				}
+				if (index < 0) {
+					index += view->ops->size(view->array);
+				}
+				return ArrayViewItem(self, index);
+			}
+			if (PySlice_Check(key)) {
+				Py_ssize_t start, stop, step;
+				if (PySlice_Unpack(key, &start, &stop, &step) < 0) {
+					return nullptr;
+				}
+				const Py_ssize_t length = PySlice_AdjustIndices(view->ops->size(view->array), &start, &stop, step);
+				return ArrayViewSlice(view, start, step, length);
+			}
+			SetTypeError("Array view indices must be integers or slices", key);
+			return nullptr;
+		}
+
+		int ArrayViewAssSubscript(PyObject* self, PyObject* key, PyObject* valueObject) {
+			ArrayViewObject* const view = GetWritableArrayView(self);
+			if (!view) {
+				return -1;
+			}
+			if (!valueObject) {
+				PyErr_SetString(PyExc_TypeError, "Array view does not support item deletion, use resize() instead");
+				return -1;
+			}
+			if (!PyIndex_Check(key)) {
+				SetTypeError("Array view indices must be integers", key);
+				return -1;
+			}
+			Py_ssize_t index = PyNumber_AsSsize_t(key, PyExc_IndexError);
+			if (index == -1 && PyErr_Occurred()) {
+				return -1;
+			}
+			const Py_ssize_t size = view->ops->size(view->array);
+			if (index < 0) {
+				index += size;
+			}
+			if (index < 0 || index >= size) {
+				PyErr_SetString(PyExc_IndexError, "array view assignment index out of range");
+				return -1;
+			}
+			return view->ops->setItem(view->array, index, valueObject) ? 0 : -1;
+		}
+
+		PyObject* ArrayViewAppend(PyObject* self, PyObject* valueObject) {
+			ArrayViewObject* const view = GetWritableArrayView(self);
+			if (!view || !view->ops->append(view->array, valueObject)) {
+				return nullptr;
+			}
+			Py_RETURN_NONE;
+		}
+
+		PyObject* ArrayViewExtend(PyObject* self, PyObject* valuesObject) {
+			ArrayViewObject* const view = GetWritableArrayView(self);
+			if (!view) {
+				return nullptr;
+			}
+			PyObject* const sequence = SequenceFast(valuesObject, "Array view can only be extended with an iterable");
+			if (!sequence) {
+				return nullptr;
+			}
+			const Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence);
+			const Py_ssize_t oldSize = view->ops->size(view->array);
+			for (Py_ssize_t i = 0; i < size; ++i) {
+				if (!view->ops->append(view->array, PySequence_Fast_GET_ITEM(sequence, i))) {
+					// Leave the vector untouched on conversion errors
+					view->ops->resize(view->array, oldSize);
+					Py_DECREF(sequence);
+					return nullptr;
+				}
+			}
+			Py_DECREF(sequence);
+			Py_RETURN_NONE;
+		}
+
+		PyObject* ArrayViewResize(PyObject* self, PyObject* sizeObject) {
+			ArrayViewObject* const view = GetWritableArrayView(self);
+			if (!view) {
+				return nullptr;
+			}
+			const Py_ssize_t size = PyNumber_AsSsize_t(sizeObject, PyExc_OverflowError);
+			if (size == -1 && PyErr_Occurred()) {
+				return nullptr;
+			}
+			if (size < 0) {
+				PyErr_SetString(PyExc_ValueError, "Array view size can't be negative");
+				return nullptr;
+			}
+			view->ops->resize(view->array, size);
+			Py_RETURN_NONE;
+		}
+
+		PyObject* ArrayViewClear(PyObject* self, [[maybe_unused]] PyObject* args) {
+			ArrayViewObject* const view = GetWritableArrayView(self);
+			if (!view) {
+				return nullptr;
+			}
+			view->ops->resize(view->array, 0);
+			Py_RETURN_NONE;
+		}
+
+		PyObject* ArrayViewToList(PyObject* self, [[maybe_unused]] PyObject* args) {
+			ArrayViewObject* const view = GetValidArrayView(self);
+			if (!view) {
+				return nullptr;
+			}
+			return ArrayViewSlice(view, 0, 1, view->ops->size(view->array));
+		}
+
+		PyObject* ArrayViewRepr(PyObject* self) {
+			auto* const view = reinterpret_cast<ArrayViewObject*>(self);
+			if (!view->array) {
+				return PyUnicode_FromString("<released ArrayView>");
+			}
+			const std::string repr(std::format("<{}ArrayView len={}>", view->writable ? "writable " : "", view->ops->size(view->array)));
+			return PyUnicode_FromStringAndSize(repr.data(), static_cast<Py_ssize_t>(repr.size()));
+		}
+
+		int ArrayViewGetBuffer(PyObject* self, Py_buffer* buffer, int flags) {
+			ArrayViewObject* const view = GetValidArrayView(self);
+			if (!view) {
+				return -1;
+			}
+			if (!view->ops->format) {
+				PyErr_SetString(PyExc_BufferError, "Array view of this type does not support the buffer protocol");
+				return -1;
+			}
+			if (flags & PyBUF_WRITABLE) {
+				PyErr_SetString(PyExc_BufferError, "Array view exports read-only snapshots");
+				return -1;
+			}
+			const Py_ssize_t itemSize = view->ops->itemSize;
+			// Writable views may have changed since the last export, refresh when nobody holds the old one
+			if (view->snapshot && view->writable && view->exports == 0) {
+				PyMem_Free(view->snapshot);
+				view->snapshot = nullptr;
+			}
+			if (!view->snapshot) {
+				const Py_ssize_t length = view->ops->size(view->array);
+				view->snapshot = PyMem_Malloc(static_cast<size_t>(length > 0 ? length * itemSize : 1));
+				if (!view->snapshot) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				if (length > 0) {
+					std::memcpy(view->snapshot, view->ops->data(view->array), static_cast<size_t>(length * itemSize));
+				}
+				view->snapshotLength = length;
+			}
+			if (PyBuffer_FillInfo(buffer, self, view->snapshot, view->snapshotLength * itemSize, 1, flags) < 0) {
+				return -1;
+			}
+			buffer->itemsize = itemSize;
+			if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT) {
+				buffer->format = const_cast<char*>(view->ops->format);
+			}
+			if ((flags & PyBUF_ND) == PyBUF_ND) {
+				buffer->shape = &view->snapshotLength;
+			}
+			++view->exports;
+			return 0;
+		}
+
+		void ArrayViewReleaseBuffer(PyObject* self, [[maybe_unused]] Py_buffer* buffer) {
+			--reinterpret_cast<ArrayViewObject*>(self)->exports;
+		}
+
+		void DeallocArrayView(PyObject* self) {
+			PyTypeObject* const type = Py_TYPE(self);
+			PyMem_Free(reinterpret_cast<ArrayViewObject*>(self)->snapshot);
+			PyObject_Free(self);
+			Py_DECREF(type);
+		}
+
+		PyType_Spec* GetArrayViewTypeSpec() {
+			static std::array methods = {
+				PyMethodDef{ "tolist", &ArrayViewToList, METH_NOARGS, nullptr },
+				PyMethodDef{ "append", &ArrayViewAppend, METH_O, nullptr },
+				PyMethodDef{ "extend", &ArrayViewExtend, METH_O, nullptr },
+				PyMethodDef{ "resize", &ArrayViewResize, METH_O, nullptr },
+				PyMethodDef{ "clear", &ArrayViewClear, METH_NOARGS, nullptr },
+				PyMethodDef{ nullptr, nullptr, 0, nullptr }
+			};
+			static std::array slots = {
+				PyType_Slot{ Py_tp_dealloc, reinterpret_cast<void*>(&DeallocArrayView) },
+				PyType_Slot{ Py_tp_repr, reinterpret_cast<void*>(&ArrayViewRepr) },
+				PyType_Slot{ Py_tp_methods, methods.data() },
+				PyType_Slot{ Py_sq_length, reinterpret_cast<void*>(&ArrayViewLength) },
+				PyType_Slot{ Py_sq_item, reinterpret_cast<void*>(&ArrayViewItem) },
+				PyType_Slot{ Py_mp_length, reinterpret_cast<void*>(&ArrayViewLength) },
+				PyType_Slot{ Py_mp_subscript, reinterpret_cast<void*>(&ArrayViewSubscript) },
+				PyType_Slot{ Py_mp_ass_subscript, reinterpret_cast<void*>(&ArrayViewAssSubscript) },
+				PyType_Slot{ Py_bf_getbuffer, reinterpret_cast<void*>(&ArrayViewGetBuffer) },
+				PyType_Slot{ Py_bf_releasebuffer, reinterpret_cast<void*>(&ArrayViewReleaseBuffer) },
+				PyType_Slot{ 0, nullptr }
+			};
+			static PyType_Spec spec = { "plugify.plugin.ArrayView", static_cast<int>(sizeof(ArrayViewObject)), 0, Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION | Py_TPFLAGS_SEQUENCE, slots.data() };
+			return &spec;
+		}
+
+		template<typename T>
+		bool AddValueObjectType(PyObject* module, PyType_Spec* spec) {
+			PyObject* const type = PyType_FromSpec(spec);
+			if (!type) {
+				return false;
+			}
+			// Module keeps the type alive until finalization
+			if (PyModule_AddType(module, reinterpret_cast<PyTypeObject*>(type)) < 0) {
+				Py_DECREF(type);
+				return false;
+			}
+			g_py3lm.GetState().valueTypes[kValueTypeIndex<T>] = reinterpret_cast<PyTypeObject*>(type);
+			Py_DECREF(type);
+			return true;
+		}
+
+		template<typename T>
+		bool AddPoolStats(PyObject* stats, const char* name) {
+			const PoolCounters& counters = ContainerPool<T>::Counters();
+			const uint64_t hits = counters.hits.load(std::memory_order_relaxed);
+			const uint64_t misses = counters.misses.load(std::memory_order_relaxed);
+			const uint64_t trimmed = counters.trimmed.load(std::memory_order_relaxed);
+			const double hitRate = hits + misses ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+			PyObject* const entry = Py_BuildValue("{s:K,s:K,s:K,s:d}", "hits", hits, "misses", misses, "trimmed", trimmed, "hit_rate", hitRate);
+			if (!entry) {
+				return false;
+			}
+			const int result = PyDict_SetItemString(stats, name, entry);
+			Py_DECREF(entry);
+			return result == 0;
+		}
+
+		// _plugify.pool_stats() -> {type: {hits, misses, trimmed, hit_rate}} summed over all threads
+		PyObject* PoolStats([[maybe_unused]] PyObject* self, [[maybe_unused]] PyObject* args) {
+			PyObject* const stats = PyDict_New();
+			if (!stats) {
+				return nullptr;
+			}
+			const bool added =
+				AddPoolStats<plg::string>(stats, "string") &&
+				AddPoolStats<plg::vector<bool>>(stats, "bool[]") &&
+				AddPoolStats<plg::vector<char>>(stats, "char8[]") &&
+				AddPoolStats<plg::vector<char16_t>>(stats, "char16[]") &&
+				AddPoolStats<plg::vector<int8_t>>(stats, "int8[]") &&
+				AddPoolStats<plg::vector<int16_t>>(stats, "int16[]") &&
+				AddPoolStats<plg::vector<int32_t>>(stats, "int32[]") &&
+				AddPoolStats<plg::vector<int64_t>>(stats, "int64[]") &&
+				AddPoolStats<plg::vector<uint8_t>>(stats, "uint8[]") &&
+				AddPoolStats<plg::vector<uint16_t>>(stats, "uint16[]") &&
+				AddPoolStats<plg::vector<uint32_t>>(stats, "uint32[]") &&
+				AddPoolStats<plg::vector<uint64_t>>(stats, "uint64[]") &&
+				AddPoolStats<plg::vector<void*>>(stats, "ptr64[]") &&
+				AddPoolStats<plg::vector<float>>(stats, "float[]") &&
+				AddPoolStats<plg::vector<double>>(stats, "double[]") &&
+				AddPoolStats<plg::vector<plg::string>>(stats, "string[]") &&
+				AddPoolStats<plg::vector<plg::any>>(stats, "any[]") &&
+				AddPoolStats<plg::vector<plg::vec2>>(stats, "vec2[]") &&
+				AddPoolStats<plg::vector<plg::vec3>>(stats, "vec3[]") &&
+				AddPoolStats<plg::vector<plg::vec4>>(stats, "vec4[]") &&
+				AddPoolStats<plg::vector<plg::mat4x4>>(stats, "mat4x4[]");
+			if (!added) {
+				Py_DECREF(stats);
+				return nullptr;
+			}
+			return stats;
+		}
+
+		// _plugify.release_callback(func) -> bool, the native side must no longer hold the function pointer.
+		// The trampoline is quarantined and later handed to another callable of the same Method, a native
+		// pointer kept past that point calls the new callable.
+		PyObject* ReleaseCallback([[maybe_unused]] PyObject* self, PyObject* object) {
+			return PyBool_FromLong(g_py3lm.ReleaseFunctionValue(object));
+		}
+
+		// _plugify.callback_stats() -> {live, recycled} trampolines made for callables passed to C++
+		PyObject* CallbackStats([[maybe_unused]] PyObject* self, [[maybe_unused]] PyObject* args) {
+			const auto [live, recycled] = g_py3lm.GetFunctionValueCounts();
+			return Py_BuildValue("{s:n,s:n}", "live", static_cast<Py_ssize_t>(live), "recycled", static_cast<Py_ssize_t>(recycled));
+		}
+
+		// _plugify.release_gil(func) -> func, variant of a native export that lets other python threads run during the call
+		PyObject* ReleaseGil([[maybe_unused]] PyObject* self, PyObject* function) {
+			return g_py3lm.CreateReleasingFunctionObject(function);
+		}
+
+		// _plugify.method_stats(module) -> {materialized, total} or None when the module binds eagerly
+		PyObject* MethodStats([[maybe_unused]] PyObject* self, PyObject* module) {
+			if (!PyModule_Check(module)) {
+				SetTypeError("Expected module", module);
+				return nullptr;
+			}
+			LazyAttributes* const lazy = FindLazyAttributes(PyModule_GetDict(module));
+			if (!lazy) {
+				Py_RETURN_NONE;
+			}
+			size_t materializedCount;
+			size_t methodCount;
+			{
+				ReadLock lock(lazy->mutex);
+				materializedCount = lazy->materializedCount;
+				methodCount = lazy->methodCount;
+			}
+			return Py_BuildValue("{s:n,s:n}", "materialized", static_cast<Py_ssize_t>(materializedCount), "total", static_cast<Py_ssize_t>(methodCount));
 		}
 
-		void GenerateEnum(const Method& method, PyObject* moduleDict);
+		PyMethodDef plugifyMethods[] = {
+			{ "pool_stats", &PoolStats, METH_NOARGS, "Hit rates of the per-thread container pools used for call marshalling" },
+			{ "release_callback", &ReleaseCallback, METH_O, "Release the C++ trampoline of a callable so it can be reused for another callable of the same method. Native code must drop the function pointer first: until reuse a stale call logs an error, after reuse it calls the new callable." },
+			{ "callback_stats", &CallbackStats, METH_NOARGS, "Counts of live and recycled callback trampolines" },
+			{ "method_stats", &MethodStats, METH_O, "Counts of materialized and total methods of a lazily bound plugin module" },
+			{ "release_gil", &ReleaseGil, METH_O, "Copy of a native export that releases the GIL while the native function runs" },
+			{ nullptr, nullptr, 0, nullptr }
+		};
 
-		void GenerateEnum(const Property& paramType, PyObject* moduleDict) {
-			if (const auto* prototype = paramType.GetPrototype()) {
-				GenerateEnum(*prototype, moduleDict);
+		// Executed once per interpreter, types and their free lists are kept in its InterpreterState
+		int ExecPlugifyModule(PyObject* module) {
+			if (!AddValueObjectType<plg::vec2>(module, GetVectorTypeSpec<plg::vec2>()) ||
+				!AddValueObjectType<plg::vec3>(module, GetVectorTypeSpec<plg::vec3>()) ||
+				!AddValueObjectType<plg::vec4>(module, GetVectorTypeSpec<plg::vec4>()) ||
+				!AddValueObjectType<plg::mat4x4>(module, GetMatrixTypeSpec())) {
+				return -1;
 			}
-			if (const auto* enumerator = paramType.GetEnumerate()) {
-				g_py3lm.CreateEnumObject(*enumerator, moduleDict);
+			PyObject* const viewType = PyType_FromSpec(GetArrayViewTypeSpec());
+			if (!viewType || PyModule_AddType(module, reinterpret_cast<PyTypeObject*>(viewType)) < 0) {
+				Py_XDECREF(viewType);
+				return -1;
 			}
+			g_py3lm.GetState().arrayViewType = reinterpret_cast<PyTypeObject*>(viewType);
+			Py_DECREF(viewType);
+			PyObject* const matrixViewType = PyType_FromSpec(GetMatrixViewTypeSpec());
+			if (!matrixViewType || PyModule_AddType(module, reinterpret_cast<PyTypeObject*>(matrixViewType)) < 0) {
+				Py_XDECREF(matrixViewType);
+				return -1;
+			}
+			g_py3lm.GetState().matrixViewType = reinterpret_cast<PyTypeObject*>(matrixViewType);
+			Py_DECREF(matrixViewType);
+			return 0;
 		}
 
-		void GenerateEnum(const Method& method, PyObject* moduleDict) {
-			GenerateEnum(method.GetRetType(), moduleDict);
-			for (const auto& paramType : method.GetParamTypes()) {
-				GenerateEnum(paramType, moduleDict);
+		PyModuleDef_Slot plugifySlots[] = {
+			{ Py_mod_exec, reinterpret_cast<void*>(&ExecPlugifyModule) },
+			{ Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED },
+#ifdef Py_GIL_DISABLED
+			// Importing a module without this re-enables the GIL
+			{ Py_mod_gil, Py_MOD_GIL_NOT_USED },
+#endif
+			{ 0, nullptr }
+		};
+
+		PyModuleDef plugifyModuleDef = {
+			PyModuleDef_HEAD_INIT,
+			"_plugify",
+			"Plugify native value types",
+			0,
+			plugifyMethods,
+			plugifySlots,
+			nullptr,
+			nullptr,
+			nullptr
+		};
+
+		PyObject* PyInit_Plugify() {
+			return PyModuleDef_Init(&plugifyModuleDef);
+		}
+
+		// Called before the interpreter ends, objects released afterwards bypass the free lists
+		void ClearValueObjectTypes(InterpreterState& state) {
+			for (auto& freeList : state.valueFreeLists) {
+				for (PyObject* const object : freeList) {
+					PyObject_GC_Del(object);
+				}
+				freeList.clear();
 			}
+			state.valueTypes = {};
+			state.arrayViewType = nullptr;
+			state.matrixViewType = nullptr;
 		}
 
 		PyObject* CustomPrint([[maybe_unused]] PyObject* self, PyObject* args, PyObject* kwargs) {
@@ -3078,6 +4984,170 @@ namespace py3lm {
 			Py_DECREF(message);
 			Py_RETURN_NONE;
 		}
+
+		constexpr size_t kSourcesPerPrecompileWorker = 16;
+		constexpr size_t kMaxPrecompileWorkers = 8;
+
+		// Reads the 'language' field of the directory's manifest, any error counts as not a python plugin
+		bool IsPythonPluginDir(const fs::path& dir, PyObject* json) {
+			std::error_code ec;
+			for (const auto& entry : fs::directory_iterator(dir, ec)) {
+				if (entry.path().extension() != ".pplugin") {
+					continue;
+				}
+				std::ifstream file(entry.path());
+				const std::string manifest((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+				PyObject* const manifestObject = PyObject_CallMethod(json, "loads", "s#", manifest.data(), static_cast<Py_ssize_t>(manifest.size()));
+				PyObject* const language = manifestObject && PyDict_Check(manifestObject) ? GetDictItemRef(manifestObject, "language") : nullptr;
+				const bool isPython = language && PyUnicode_Check(language) && PyUnicode_CompareWithASCIIString(language, "python3") == 0;
+				Py_XDECREF(language);
+				Py_XDECREF(manifestObject);
+				PyErr_Clear();
+				return isPython;
+			}
+			return false;
+		}
+
+		// Sources of every python plugin installed next to this module
+		std::vector<fs::path> FindPluginSources(const fs::path& extensionsPath, const fs::path& moduleBasePath) {
+			std::vector<fs::path> sources;
+			PyObject* const json = PyImport_ImportModule("json");
+			if (!json) {
+				PyErr_Clear();
+				return sources;
+			}
+			std::error_code ec;
+			for (const auto& pluginEntry : fs::directory_iterator(extensionsPath, ec)) {
+				if (!pluginEntry.is_directory(ec) || fs::equivalent(pluginEntry.path(), moduleBasePath, ec) || !IsPythonPluginDir(pluginEntry.path(), json)) {
+					continue;
+				}
+				auto it = fs::recursive_directory_iterator(pluginEntry.path(), fs::directory_options::skip_permission_denied, ec);
+				for (; !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+					const fs::path& path = it->path();
+					if (it->is_directory(ec)) {
+						if (path.filename() == "__pycache__" || path.filename().string().starts_with('.')) {
+							it.disable_recursion_pending();
+						}
+						continue;
+					}
+					if (path.extension() == ".py") {
+						sources.push_back(path);
+					}
+				}
+			}
+			Py_DECREF(json);
+			return sources;
+		}
+
+		// Each worker runs its own sub-interpreter with its own GIL, so compilation is truly parallel.
+		// compileall skips sources whose .pyc is up to date, a warm start only reads the headers.
+		size_t CompileSourcesWorker(const std::vector<fs::path>& sources, std::atomic<size_t>& next, const std::string& pycachePrefix) {
+			PyInterpreterConfig config = {
+				.use_main_obmalloc = 0,
+				.allow_fork = 0,
+				.allow_exec = 0,
+				.allow_threads = 1,
+				.allow_daemon_threads = 0,
+				.check_multi_interp_extensions = 1,
+				.gil = PyInterpreterConfig_OWN_GIL,
+			};
+			PyThreadState* tstate = nullptr;
+			if (PyStatus_Exception(Py_NewInterpreterFromConfig(&tstate, &config))) {
+				return 0;
+			}
+
+			size_t compiled = 0;
+			if (!pycachePrefix.empty()) {
+				PyObject* const prefixObject = PyUnicode_FromStringView(pycachePrefix);
+				if (!prefixObject || PySys_SetObject("pycache_prefix", prefixObject) < 0) {
+					PyErr_Clear();
+				}
+				Py_XDECREF(prefixObject);
+			}
+			if (PyObject* const compileall = PyImport_ImportModule("compileall")) {
+				for (size_t index; (index = next.fetch_add(1, std::memory_order_relaxed)) < sources.size();) {
+					// compile_file(fullname, ddir=None, force=False, rx=None, quiet=2)
+					PyObject* const result = PyObject_CallMethod(compileall, "compile_file", "sOOOi", plg::as_string(sources[index]).c_str(), Py_None, Py_False, Py_None, 2);
+					if (result && PyObject_IsTrue(result) == 1) {
+						++compiled;
+					}
+					Py_XDECREF(result);
+					PyErr_Clear();
+				}
+				Py_DECREF(compileall);
+			}
+			PyErr_Clear();
+
+			Py_EndInterpreter(tstate);
+			return compiled;
+		}
+
+		// Sources with a missing or older .pyc, so a warm start spawns no workers at all
+		std::vector<fs::path> FindStaleSources(const std::vector<fs::path>& sources) {
+			PyObject* const importlibUtil = PyImport_ImportModule("importlib.util");
+			if (!importlibUtil) {
+				PyErr_Clear();
+				return sources;
+			}
+			std::vector<fs::path> staleSources;
+			std::error_code ec;
+			for (const auto& source : sources) {
+				PyObject* const cachePath = PyObject_CallMethod(importlibUtil, "cache_from_source", "s", plg::as_string(source).c_str());
+				wchar_t* const bytecodePath = cachePath ? PyUnicode_AsWideCharString(cachePath, nullptr) : nullptr;
+				Py_XDECREF(cachePath);
+				if (!bytecodePath) {
+					PyErr_Clear();
+					continue;
+				}
+				const auto bytecodeTime = fs::last_write_time(bytecodePath, ec);
+				PyMem_Free(bytecodePath);
+				if (ec || bytecodeTime < fs::last_write_time(source, ec)) {
+					staleSources.push_back(source);
+				}
+			}
+			Py_DECREF(importlibUtil);
+			return staleSources;
+		}
+
+		// Returns the number of sources compiled
+		size_t PrecompileSources(const std::vector<fs::path>& sources, const std::string& pycachePrefix, size_t& workerCount) {
+			workerCount = std::clamp<size_t>(std::min<size_t>(std::thread::hardware_concurrency(), sources.size() / kSourcesPerPrecompileWorker + 1), 1, kMaxPrecompileWorkers);
+
+			std::atomic<size_t> next{};
+			std::atomic<size_t> compiled{};
+			std::vector<std::thread> workers;
+			workers.reserve(workerCount);
+
+			Py_BEGIN_ALLOW_THREADS
+			for (size_t i = 0; i < workerCount; ++i) {
+				workers.emplace_back([&] {
+					compiled.fetch_add(CompileSourcesWorker(sources, next, pycachePrefix), std::memory_order_relaxed);
+				});
+			}
+			for (auto& worker : workers) {
+				worker.join();
+			}
+			Py_END_ALLOW_THREADS
+
+			return compiled.load(std::memory_order_relaxed);
+		}
+	}
+
+	namespace {
+		// InterpreterState of the current interpreter as last looked up by this thread
+		struct CachedState {
+			PyInterpreterState* interpreter;
+			InterpreterState* state;
+			uint64_t generation;
+		};
+		thread_local CachedState t_cachedState{};
+
+		// Thread states the calling thread made for interpreters other than its own
+		struct ThreadStateCache {
+			uint64_t generation;
+			std::vector<std::pair<PyInterpreterState*, PyThreadState*>> threadStates;
+		};
+		thread_local ThreadStateCache t_threadStates{};
 	}
 
 	Python3LanguageModule::Python3LanguageModule() = default;
@@ -3085,6 +5155,8 @@ namespace py3lm {
 	Python3LanguageModule::~Python3LanguageModule() = default;
 
 	Result<InitData> Python3LanguageModule::Initialize(const Provider& provider, const Extension& module) {
+		const auto initStart = std::chrono::steady_clock::now();
+
 		_provider = std::make_unique<Provider>(provider);
 
 		std::error_code ec;
@@ -3098,12 +5170,12 @@ namespace py3lm {
 			return MakeError("lib directory not exists");
 		}
 
-		const fs::path pythonBasePath = moduleBasePath / "python3.12";
+		const fs::path pythonBasePath = moduleBasePath / PY3LM_PYTHON_DIR;
 		if (!fs::exists(pythonBasePath, ec) || !fs::is_directory(pythonBasePath, ec)) {
-			return MakeError("python3.12 directory not exists");
+			return MakeError("{} directory not exists", PY3LM_PYTHON_DIR);
 		}
 
-		const fs::path modulesZipPath = pythonBasePath / L"python312.zip";
+		const fs::path modulesZipPath = pythonBasePath / PY3LM_PYTHON_ZIP;
 		const fs::path extensionsPath = fs::weakly_canonical(moduleBasePath / "..", ec);
 		if (ec) {
 			return MakeError("Failed to get extensions directory path");
@@ -3113,8 +5185,23 @@ namespace py3lm {
 			return MakeError("Python already initialized");
 		}
 
+		// Inittab is process wide and must be extended only once, before the first initialization
+		static const int inittabResult = PyImport_AppendInittab("_plugify", &PyInit_Plugify);
+		if (inittabResult != 0) {
+			return MakeError("Failed to register _plugify builtin module");
+		}
+
+#if PY3LM_FROZEN_MODULES
+		// plugify runtime and the hot stdlib subset are unmarshalled from the library image instead of the path finders
+		PyImport_FrozenModules = kFrozenModules;
+#endif
+
 		PyStatus status;
 
+		// Bytecode goes to the cache dir instead of __pycache__ next to the sources
+		const std::string_view pycacheDir = PY3LM_PYCACHE_PREFIX;
+		const fs::path pycachePrefix = pycacheDir.empty() ? fs::path() : _provider->GetCacheDir() / pycacheDir;
+
 		PyConfig config{};
 		PyConfig_InitIsolatedConfig(&config);
 
@@ -3124,6 +5211,13 @@ namespace py3lm {
 				break;
 			}
 
+			if (!pycachePrefix.empty()) {
+				status = PyConfig_SetString(&config, &config.pycache_prefix, pycachePrefix.wstring().c_str());
+				if (PyStatus_Exception(status)) {
+					break;
+				}
+			}
+
 			// Manually set search paths:
 			// 1. python zip
 			// 2. python dir
@@ -3158,6 +5252,42 @@ namespace py3lm {
 			return MakeError("Failed to init python: {}", status.err_msg);
 		}
 
+#if PY3LM_PRECOMPILE_SOURCES
+		// Plugins then only unmarshal their code on import. Without a prefix bytecode stays next to the sources,
+		// where the regular import writes it anyway, so the scan is skipped.
+		if (!pycachePrefix.empty()) {
+			const auto sources = FindPluginSources(extensionsPath, moduleBasePath);
+			if (const auto staleSources = FindStaleSources(sources); !staleSources.empty()) {
+				const auto start = std::chrono::steady_clock::now();
+				size_t workerCount = 0;
+				const size_t compiled = PrecompileSources(staleSources, plg::as_string(pycachePrefix), workerCount);
+				const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+				_provider->Log(std::format(LOG_PREFIX "Precompiled {}/{} stale of {} plugin sources with {} workers in {} ms", compiled, staleSources.size(), sources.size(), workerCount, elapsed.count()), Severity::Verbose);
+			}
+		}
+#endif
+
+		_states.push_back(std::make_unique<InterpreterState>());
+		InterpreterState& state = *_states.front();
+		state.interpreter = PyInterpreterState_Main();
+
+		if (auto result = SetupInterpreterState(state); !result) {
+			return std::unexpected(std::move(result.error()));
+		}
+
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+		// Entry points attach to the interpreter they need, the host thread is not left in any between calls
+		state.threadState = PyEval_SaveThread();
+#endif
+
+		const auto initElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - initStart);
+		_provider->Log(std::format(LOG_PREFIX "Interpreter initialized in {} ms{}", initElapsed.count(), PY3LM_FROZEN_MODULES ? " (frozen modules)" : ""), Severity::Verbose);
+
+		return InitData{{ .hasUpdate = PY3LM_BATCHED_UPDATE }};
+	}
+
+	// Imports the plugify runtime into the current interpreter and resolves what the module needs from it
+	Result<void> Python3LanguageModule::SetupInterpreterState(InterpreterState& state) {
 		PyObject* const plugifyPluginModuleName = PyUnicode_DecodeFSDefault("plugify.plugin");
 		if (!plugifyPluginModuleName) {
 			LogError();
@@ -3171,65 +5301,71 @@ namespace py3lm {
 			return MakeError("Failed to import plugify.plugin python module");
 		}
 
-		_PluginTypeObject = PyObject_GetAttrString(plugifyPluginModule, "Plugin");
-		if (!_PluginTypeObject) {
+		state.pluginType = PyObject_GetAttrString(plugifyPluginModule, "Plugin");
+		if (!state.pluginType) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
 			return MakeError("Failed to find plugify.plugin.Plugin type");
 		}
-		_PluginInfoTypeObject = PyObject_GetAttrString(plugifyPluginModule, "PluginInfo");
-		if (!_PluginInfoTypeObject) {
+		state.pluginInfoType = PyObject_GetAttrString(plugifyPluginModule, "PluginInfo");
+		if (!state.pluginInfoType) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
 			return MakeError("Failed to find plugify.plugin.PluginInfo type");
 		}
 
-		_Vector2TypeObject = PyObject_GetAttrString(plugifyPluginModule, "Vector2");
-		if (!_Vector2TypeObject) {
+		state.vector2Type = PyObject_GetAttrString(plugifyPluginModule, "Vector2");
+		if (!state.vector2Type) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
 			return MakeError("Failed to find plugify.plugin.Vector2 type");
 		}
-		_Vector3TypeObject = PyObject_GetAttrString(plugifyPluginModule, "Vector3");
-		if (!_Vector3TypeObject) {
+		state.vector3Type = PyObject_GetAttrString(plugifyPluginModule, "Vector3");
+		if (!state.vector3Type) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
 			return MakeError("Failed to find plugify.plugin.Vector3 type");
 		}
-		_Vector4TypeObject = PyObject_GetAttrString(plugifyPluginModule, "Vector4");
-		if (!_Vector4TypeObject) {
+		state.vector4Type = PyObject_GetAttrString(plugifyPluginModule, "Vector4");
+		if (!state.vector4Type) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
 			return MakeError("Failed to find plugify.plugin.Vector4 type");
 		}
-		_Matrix4x4TypeObject = PyObject_GetAttrString(plugifyPluginModule, "Matrix4x4");
-		if (!_Matrix4x4TypeObject) {
+		state.matrix4x4Type = PyObject_GetAttrString(plugifyPluginModule, "Matrix4x4");
+		if (!state.matrix4x4Type) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
 			return MakeError("Failed to find plugify.plugin.Matrix4x4 type");
 		}
 
-		_ExtractRequiredModulesObject = PyObject_GetAttrString(plugifyPluginModule, "extract_required_modules");
-		if (!_ExtractRequiredModulesObject || !PyCallable_Check(_ExtractRequiredModulesObject)) {
+		state.extractRequiredModules = PyObject_GetAttrString(plugifyPluginModule, "scan_required_modules");
+		if (!state.extractRequiredModules || !PyCallable_Check(state.extractRequiredModules)) {
 			Py_DECREF(plugifyPluginModule);
 			LogError();
-			return MakeError("Failed to find plugify.plugin.extract_required_modules function");
+			return MakeError("Failed to find plugify.plugin.scan_required_modules function");
 		}
 
 		Py_DECREF(plugifyPluginModule);
 
-		_ppsModule = PyImport_ImportModule("plugify.pps");
-		if (!_ppsModule) {
+		state.ppsModule = PyImport_ImportModule("plugify.pps");
+		if (!state.ppsModule) {
 			LogError();
 			return MakeError("Failed to import plugify.pps python module");
 		}
 
-		_enumModule = PyImport_ImportModule("enum");
-		if (!_enumModule) {
+		state.enumModule = PyImport_ImportModule("enum");
+		if (!state.enumModule) {
 			LogError();
 			return MakeError("Failed to import enum python module");
 		}
 
+		state.enumType = PyObject_GetAttrString(state.enumModule, "Enum");
+		if (!state.enumType) {
+			LogError();
+			return MakeError("Failed to find enum.Enum class");
+		}
+
 		PyObject* const builtinsModule = PyImport_ImportModule("builtins");
 		if (!builtinsModule) {
 			LogError();
@@ -3257,8 +5393,8 @@ namespace py3lm {
 			LogError();
 			return MakeError("Failed to import traceback python module");
 		}
-		_formatException = PyObject_GetAttrString(tracebackModule, "format_exception");
-		if (!_formatException) {
+		state.formatException = PyObject_GetAttrString(tracebackModule, "format_exception");
+		if (!state.formatException) {
 			Py_DECREF(tracebackModule);
 			LogError();
 			return MakeError("Failed to import traceback.format_exception python module");
@@ -3266,183 +5402,236 @@ namespace py3lm {
 
 		Py_DECREF(tracebackModule);
 
-		_typeMap.try_emplace(&PyType_Type, PyAbstractType::Type, "Type");
-		_typeMap.try_emplace(&PyBaseObject_Type, PyAbstractType::BaseObject, "BaseObject");
-		_typeMap.try_emplace(&PyLong_Type, PyAbstractType::Long, "Long");
-		_typeMap.try_emplace(&PyBool_Type, PyAbstractType::Bool, "Bool");
-		_typeMap.try_emplace(&PyEllipsis_Type, PyAbstractType::Ellipsis, "Ellipsis");
-		_typeMap.try_emplace(Py_TYPE(Py_None), PyAbstractType::None, "None");
-		_typeMap.try_emplace(Py_TYPE(Py_NotImplemented), PyAbstractType::NotImplemented, "NotImplemented");
-		_typeMap.try_emplace(&PyByteArrayIter_Type, PyAbstractType::ByteArrayIter, "ByteArrayIter");
-		_typeMap.try_emplace(&PyByteArray_Type, PyAbstractType::ByteArray, "ByteArray");
-		_typeMap.try_emplace(&PyBytesIter_Type, PyAbstractType::BytesIter, "BytesIter");
-		_typeMap.try_emplace(&PyBytes_Type, PyAbstractType::Bytes, "Bytes");
-		_typeMap.try_emplace(&PyCFunction_Type, PyAbstractType::CFunction, "CFunction");
-		_typeMap.try_emplace(&PyCallIter_Type, PyAbstractType::CallIter, "CallIter");
-		_typeMap.try_emplace(&PyCapsule_Type, PyAbstractType::Capsule, "Capsule");
-		_typeMap.try_emplace(&PyCell_Type, PyAbstractType::Cell, "Cell");
-		_typeMap.try_emplace(&PyClassMethod_Type, PyAbstractType::ClassMethod, "ClassMethod");
-		_typeMap.try_emplace(&PyComplex_Type, PyAbstractType::Complex, "Complex");
-		_typeMap.try_emplace(&PyDictItems_Type, PyAbstractType::DictItems, "DictItems");
-		_typeMap.try_emplace(&PyDictIterItem_Type, PyAbstractType::DictIterItem, "DictIterItem");
-		_typeMap.try_emplace(&PyDictIterKey_Type, PyAbstractType::DictIterKey, "DictIterKey");
-		_typeMap.try_emplace(&PyDictIterValue_Type, PyAbstractType::DictIterValue, "DictIterValue");
-		_typeMap.try_emplace(&PyDictKeys_Type, PyAbstractType::DictKeys, "DictKeys");
-		_typeMap.try_emplace(&PyDictProxy_Type, PyAbstractType::DictProxy, "DictProxy");
-		_typeMap.try_emplace(&PyDictValues_Type, PyAbstractType::DictValues, "DictValues");
-		_typeMap.try_emplace(&PyDict_Type, PyAbstractType::Dict, "Dict");
-		_typeMap.try_emplace(&PyEllipsis_Type, PyAbstractType::Ellipsis, "Ellipsis");
-		_typeMap.try_emplace(&PyEnum_Type, PyAbstractType::Enum, "Enum");
-		_typeMap.try_emplace(&PyFilter_Type, PyAbstractType::Filter, "Filter");
-		_typeMap.try_emplace(&PyFloat_Type, PyAbstractType::Float, "Float");
-		_typeMap.try_emplace(&PyFrame_Type, PyAbstractType::Frame, "Frame");
-		_typeMap.try_emplace(&PyFrozenSet_Type, PyAbstractType::FrozenSet, "FrozenSet");
-		_typeMap.try_emplace(&PyFunction_Type, PyAbstractType::Function, "Function");
-		_typeMap.try_emplace(&PyGen_Type, PyAbstractType::Gen, "Gen");
-		_typeMap.try_emplace(&PyInstanceMethod_Type, PyAbstractType::InstanceMethod, "InstanceMethod");
-		_typeMap.try_emplace(&PyListIter_Type, PyAbstractType::ListIter, "ListIter");
-		_typeMap.try_emplace(&PyListRevIter_Type, PyAbstractType::ListRevIter, "ListRevIter");
-		_typeMap.try_emplace(&PyList_Type, PyAbstractType::List, "List");
-		_typeMap.try_emplace(&PyLongRangeIter_Type, PyAbstractType::LongRangeIter, "LongRangeIter");
-		_typeMap.try_emplace(&PyMap_Type, PyAbstractType::Map, "Map");
-		_typeMap.try_emplace(&PyMemoryView_Type, PyAbstractType::MemoryView, "MemoryView");
-		_typeMap.try_emplace(&PyMethod_Type, PyAbstractType::Method, "Method");
-		_typeMap.try_emplace(&PyModule_Type, PyAbstractType::Module, "Module");
-		_typeMap.try_emplace(&PyProperty_Type, PyAbstractType::Property, "Property");
-		_typeMap.try_emplace(&PyRangeIter_Type, PyAbstractType::RangeIter, "RangeIter");
-		_typeMap.try_emplace(&PyRange_Type, PyAbstractType::Range, "Range");
-		_typeMap.try_emplace(&PySeqIter_Type, PyAbstractType::SeqIter, "SeqIter");
-		_typeMap.try_emplace(&PySetIter_Type, PyAbstractType::SetIter, "SetIter");
-		_typeMap.try_emplace(&PySet_Type, PyAbstractType::Set, "Set");
-		_typeMap.try_emplace(&PySlice_Type, PyAbstractType::Slice, "Slice");
-		_typeMap.try_emplace(&PyStaticMethod_Type, PyAbstractType::StaticMethod, "StaticMethod");
-		_typeMap.try_emplace(&PyTraceBack_Type, PyAbstractType::TraceBack, "TraceBack");
-		_typeMap.try_emplace(&PyTupleIter_Type, PyAbstractType::TupleIter, "TupleIter");
-		_typeMap.try_emplace(&PyTuple_Type, PyAbstractType::Tuple, "Tuple");
-		_typeMap.try_emplace(&PyUnicodeIter_Type, PyAbstractType::UnicodeIter, "UnicodeIter");
-		_typeMap.try_emplace(&PyUnicode_Type, PyAbstractType::Unicode, "Unicode");
-		_typeMap.try_emplace(&PyZip_Type, PyAbstractType::Zip, "Zip");
-		_typeMap.try_emplace(&PyStdPrinter_Type, PyAbstractType::StdPrinter, "StdPrinter");
-		_typeMap.try_emplace(&PyCode_Type, PyAbstractType::Code, "STEntry");
-		_typeMap.try_emplace(&PyReversed_Type, PyAbstractType::Reversed, "Reversed");
-		_typeMap.try_emplace(&PyClassMethodDescr_Type, PyAbstractType::ClassMethodDescr, "ClassMethodDescr");
-		_typeMap.try_emplace(&PyGetSetDescr_Type, PyAbstractType::GetSetDescr, "GetSetDescr");
-		_typeMap.try_emplace(&PyWrapperDescr_Type, PyAbstractType::WrapperDescr, "WrapperDescr");
-		_typeMap.try_emplace(&PyMethodDescr_Type, PyAbstractType::MethodDescr, "MethodDescr");
-		_typeMap.try_emplace(&PyMemberDescr_Type, PyAbstractType::MemberDescr, "MemberDescr");
-		_typeMap.try_emplace(&PySuper_Type, PyAbstractType::Super, "Super");
-
-		_typeMap.try_emplace(Py_TYPE(_Vector2TypeObject), PyAbstractType::Vector2, "Vector2");
-		_typeMap.try_emplace(Py_TYPE(_Vector3TypeObject), PyAbstractType::Vector3, "Vector3");
-		_typeMap.try_emplace(Py_TYPE(_Vector4TypeObject), PyAbstractType::Vector4, "Vector4");
-		_typeMap.try_emplace(Py_TYPE(_Matrix4x4TypeObject), PyAbstractType::Matrix4x4, "Matrix4x4");
-
-		return InitData{{ .hasUpdate = false }};
+		state.typeMap.try_emplace(&PyType_Type, PyAbstractType::Type, "Type");
+		state.typeMap.try_emplace(&PyBaseObject_Type, PyAbstractType::BaseObject, "BaseObject");
+		state.typeMap.try_emplace(&PyLong_Type, PyAbstractType::Long, "Long");
+		state.typeMap.try_emplace(&PyBool_Type, PyAbstractType::Bool, "Bool");
+		state.typeMap.try_emplace(&PyEllipsis_Type, PyAbstractType::Ellipsis, "Ellipsis");
+		state.typeMap.try_emplace(Py_TYPE(Py_None), PyAbstractType::None, "None");
+		state.typeMap.try_emplace(Py_TYPE(Py_NotImplemented), PyAbstractType::NotImplemented, "NotImplemented");
+		state.typeMap.try_emplace(&PyByteArrayIter_Type, PyAbstractType::ByteArrayIter, "ByteArrayIter");
+		state.typeMap.try_emplace(&PyByteArray_Type, PyAbstractType::ByteArray, "ByteArray");
+		state.typeMap.try_emplace(&PyBytesIter_Type, PyAbstractType::BytesIter, "BytesIter");
+		state.typeMap.try_emplace(&PyBytes_Type, PyAbstractType::Bytes, "Bytes");
+		state.typeMap.try_emplace(&PyCFunction_Type, PyAbstractType::CFunction, "CFunction");
+		state.typeMap.try_emplace(&PyCallIter_Type, PyAbstractType::CallIter, "CallIter");
+		state.typeMap.try_emplace(&PyCapsule_Type, PyAbstractType::Capsule, "Capsule");
+		state.typeMap.try_emplace(&PyCell_Type, PyAbstractType::Cell, "Cell");
+		state.typeMap.try_emplace(&PyClassMethod_Type, PyAbstractType::ClassMethod, "ClassMethod");
+		state.typeMap.try_emplace(&PyComplex_Type, PyAbstractType::Complex, "Complex");
+		state.typeMap.try_emplace(&PyDictItems_Type, PyAbstractType::DictItems, "DictItems");
+		state.typeMap.try_emplace(&PyDictIterItem_Type, PyAbstractType::DictIterItem, "DictIterItem");
+		state.typeMap.try_emplace(&PyDictIterKey_Type, PyAbstractType::DictIterKey, "DictIterKey");
+		state.typeMap.try_emplace(&PyDictIterValue_Type, PyAbstractType::DictIterValue, "DictIterValue");
+		state.typeMap.try_emplace(&PyDictKeys_Type, PyAbstractType::DictKeys, "DictKeys");
+		state.typeMap.try_emplace(&PyDictProxy_Type, PyAbstractType::DictProxy, "DictProxy");
+		state.typeMap.try_emplace(&PyDictValues_Type, PyAbstractType::DictValues, "DictValues");
+		state.typeMap.try_emplace(&PyDict_Type, PyAbstractType::Dict, "Dict");
+		state.typeMap.try_emplace(&PyEllipsis_Type, PyAbstractType::Ellipsis, "Ellipsis");
+		state.typeMap.try_emplace(&PyEnum_Type, PyAbstractType::Enum, "Enum");
+		state.typeMap.try_emplace(&PyFilter_Type, PyAbstractType::Filter, "Filter");
+		state.typeMap.try_emplace(&PyFloat_Type, PyAbstractType::Float, "Float");
+		state.typeMap.try_emplace(&PyFrame_Type, PyAbstractType::Frame, "Frame");
+		state.typeMap.try_emplace(&PyFrozenSet_Type, PyAbstractType::FrozenSet, "FrozenSet");
+		state.typeMap.try_emplace(&PyFunction_Type, PyAbstractType::Function, "Function");
+		state.typeMap.try_emplace(&PyGen_Type, PyAbstractType::Gen, "Gen");
+		state.typeMap.try_emplace(&PyInstanceMethod_Type, PyAbstractType::InstanceMethod, "InstanceMethod");
+		state.typeMap.try_emplace(&PyListIter_Type, PyAbstractType::ListIter, "ListIter");
+		state.typeMap.try_emplace(&PyListRevIter_Type, PyAbstractType::ListRevIter, "ListRevIter");
+		state.typeMap.try_emplace(&PyList_Type, PyAbstractType::List, "List");
+		state.typeMap.try_emplace(&PyLongRangeIter_Type, PyAbstractType::LongRangeIter, "LongRangeIter");
+		state.typeMap.try_emplace(&PyMap_Type, PyAbstractType::Map, "Map");
+		state.typeMap.try_emplace(&PyMemoryView_Type, PyAbstractType::MemoryView, "MemoryView");
+		state.typeMap.try_emplace(&PyMethod_Type, PyAbstractType::Method, "Method");
+		state.typeMap.try_emplace(&PyModule_Type, PyAbstractType::Module, "Module");
+		state.typeMap.try_emplace(&PyProperty_Type, PyAbstractType::Property, "Property");
+		state.typeMap.try_emplace(&PyRangeIter_Type, PyAbstractType::RangeIter, "RangeIter");
+		state.typeMap.try_emplace(&PyRange_Type, PyAbstractType::Range, "Range");
+		state.typeMap.try_emplace(&PySeqIter_Type, PyAbstractType::SeqIter, "SeqIter");
+		state.typeMap.try_emplace(&PySetIter_Type, PyAbstractType::SetIter, "SetIter");
+		state.typeMap.try_emplace(&PySet_Type, PyAbstractType::Set, "Set");
+		state.typeMap.try_emplace(&PySlice_Type, PyAbstractType::Slice, "Slice");
+		state.typeMap.try_emplace(&PyStaticMethod_Type, PyAbstractType::StaticMethod, "StaticMethod");
+		state.typeMap.try_emplace(&PyTraceBack_Type, PyAbstractType::TraceBack, "TraceBack");
+		state.typeMap.try_emplace(&PyTupleIter_Type, PyAbstractType::TupleIter, "TupleIter");
+		state.typeMap.try_emplace(&PyTuple_Type, PyAbstractType::Tuple, "Tuple");
+		state.typeMap.try_emplace(&PyUnicodeIter_Type, PyAbstractType::UnicodeIter, "UnicodeIter");
+		state.typeMap.try_emplace(&PyUnicode_Type, PyAbstractType::Unicode, "Unicode");
+		state.typeMap.try_emplace(&PyZip_Type, PyAbstractType::Zip, "Zip");
+		state.typeMap.try_emplace(&PyStdPrinter_Type, PyAbstractType::StdPrinter, "StdPrinter");
+		state.typeMap.try_emplace(&PyCode_Type, PyAbstractType::Code, "STEntry");
+		state.typeMap.try_emplace(&PyReversed_Type, PyAbstractType::Reversed, "Reversed");
+		state.typeMap.try_emplace(&PyClassMethodDescr_Type, PyAbstractType::ClassMethodDescr, "ClassMethodDescr");
+		state.typeMap.try_emplace(&PyGetSetDescr_Type, PyAbstractType::GetSetDescr, "GetSetDescr");
+		state.typeMap.try_emplace(&PyWrapperDescr_Type, PyAbstractType::WrapperDescr, "WrapperDescr");
+		state.typeMap.try_emplace(&PyMethodDescr_Type, PyAbstractType::MethodDescr, "MethodDescr");
+		state.typeMap.try_emplace(&PyMemberDescr_Type, PyAbstractType::MemberDescr, "MemberDescr");
+		state.typeMap.try_emplace(&PySuper_Type, PyAbstractType::Super, "Super");
+
+		state.typeMap.try_emplace(reinterpret_cast<PyTypeObject*>(state.vector2Type), PyAbstractType::Vector2, "Vector2");
+		state.typeMap.try_emplace(reinterpret_cast<PyTypeObject*>(state.vector3Type), PyAbstractType::Vector3, "Vector3");
+		state.typeMap.try_emplace(reinterpret_cast<PyTypeObject*>(state.vector4Type), PyAbstractType::Vector4, "Vector4");
+		state.typeMap.try_emplace(reinterpret_cast<PyTypeObject*>(state.matrix4x4Type), PyAbstractType::Matrix4x4, "Matrix4x4");
+
+		return {};
+	}
+
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+	// Each plugin gets its own interpreter with its own GIL, module cache and object allocator
+	Result<InterpreterState*> Python3LanguageModule::CreatePluginInterpreter() {
+		PyInterpreterConfig config = {
+			.use_main_obmalloc = 0,
+			.allow_fork = 0,
+			.allow_exec = 0,
+			.allow_threads = 1,
+			.allow_daemon_threads = 0,
+			.check_multi_interp_extensions = 1,
+			.gil = PyInterpreterConfig_OWN_GIL,
+		};
+		PyThreadState* threadState = nullptr;
+		const PyStatus status = Py_NewInterpreterFromConfig(&threadState, &config);
+		if (PyStatus_Exception(status)) {
+			return MakeError("Failed to create interpreter: {}", status.err_msg ? status.err_msg : "unknown error");
+		}
+
+		InterpreterState* const state = [&] {
+			std::lock_guard lock(_statesMutex);
+			auto& result = _states.emplace_back(std::make_unique<InterpreterState>());
+			result->interpreter = PyThreadState_GetInterpreter(threadState);
+			result->threadState = threadState;
+			return result.get();
+		}();
+
+		// Left registered on failure, it ends with the others on shutdown
+		auto result = SetupInterpreterState(*state);
+		PyEval_SaveThread();
+		if (!result) {
+			return std::unexpected(std::move(result.error()));
+		}
+
+		return state;
 	}
+#endif
 
 	void Python3LanguageModule::Shutdown() {
 		if (Py_IsInitialized()) {
-			if (_formatException) {
-				Py_DECREF(_formatException);
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+			// Plugin interpreters end first, each with the host thread state it was created with
+			for (size_t i = _states.size(); i-- > 1;) {
+				InterpreterState& state = *_states[i];
+				PyEval_RestoreThread(state.threadState);
+				ReleaseInterpreterState(state);
+				for (PyThreadState* const threadState : state.threadStates) {
+					PyThreadState_Clear(threadState);
+					PyThreadState_Delete(threadState);
+				}
+				Py_EndInterpreter(state.threadState);
 			}
 
-			if (_enumModule) {
-				Py_DECREF(_enumModule);
+			if (!_states.empty() && _states.front()->threadState) {
+				PyEval_RestoreThread(_states.front()->threadState);
 			}
-
-			if (_ppsModule) {
-				if (PyObject* const moduleDict = PyModule_GetDict(_ppsModule)) {
-					PyDict_Clear(moduleDict);
-				}
-				Py_DECREF(_ppsModule);
+#endif
+			if (!_states.empty()) {
+				ReleaseInterpreterState(*_states.front());
 			}
 
-			if (_Vector2TypeObject) {
-				Py_DECREF(_Vector2TypeObject);
-			}
+			Py_Finalize();
+		}
+		_states.clear();
+		++_statesGeneration;
+		_jitCalls.clear();
+		_pluginsMap.clear();
+		_updates.clear();
+		_startedUpdates.clear();
+		_provider.reset();
+	}
 
-			if (_Vector3TypeObject) {
-				Py_DECREF(_Vector3TypeObject);
-			}
+	// Drops the references the module holds in an interpreter, which must be the current one
+	void Python3LanguageModule::ReleaseInterpreterState(InterpreterState& state) {
+		if (state.formatException) {
+			Py_DECREF(state.formatException);
+		}
 
-			if (_Vector4TypeObject) {
-				Py_DECREF(_Vector4TypeObject);
-			}
+		if (state.enumType) {
+			Py_DECREF(state.enumType);
+		}
 
-			if (_Matrix4x4TypeObject) {
-				Py_DECREF(_Matrix4x4TypeObject);
-			}
+		if (state.enumModule) {
+			Py_DECREF(state.enumModule);
+		}
 
-			if (_ExtractRequiredModulesObject) {
-				Py_DECREF(_ExtractRequiredModulesObject);
+		if (state.ppsModule) {
+			if (PyObject* const moduleDict = PyModule_GetDict(state.ppsModule)) {
+				PyDict_Clear(moduleDict);
 			}
+			Py_DECREF(state.ppsModule);
+		}
 
-			if (_PluginTypeObject) {
-				Py_DECREF(_PluginTypeObject);
-			}
+		if (state.vector2Type) {
+			Py_DECREF(state.vector2Type);
+		}
 
-			if (_PluginInfoTypeObject) {
-				Py_DECREF(_PluginInfoTypeObject);
-			}
+		if (state.vector3Type) {
+			Py_DECREF(state.vector3Type);
+		}
 
-			for (const auto& data : _internalFunctions) {
-				Py_DECREF(data.pythonFunction);
-			}
+		if (state.vector4Type) {
+			Py_DECREF(state.vector4Type);
+		}
 
-			for (const auto& [_1, _2, _3, object] : _externalFunctions) {
-				Py_DECREF(object);
-			}
+		if (state.matrix4x4Type) {
+			Py_DECREF(state.matrix4x4Type);
+		}
 
-			for (const auto& data : _pythonMethods) {
-				Py_DECREF(data.pythonFunction);
-			}
+		if (state.extractRequiredModules) {
+			Py_DECREF(state.extractRequiredModules);
+		}
 
-			for (const auto& [object, _] : _internalEnumMap) {
-				Py_DECREF(object);
-			}
+		if (state.pluginType) {
+			Py_DECREF(state.pluginType);
+		}
 
-			for (const auto& [_, pluginData] : _pluginsMap) {
+		if (state.pluginInfoType) {
+			Py_DECREF(state.pluginInfoType);
+		}
+
+		for (const auto& [_, holder] : state.internalFunctions) {
+			Py_DECREF(holder.data.pythonFunction);
+		}
+
+		for (const auto& [_1, _2, object] : state.externalFunctions) {
+			Py_DECREF(object);
+		}
+
+		for (const auto& data : state.pythonMethods) {
+			Py_DECREF(data.pythonFunction);
+		}
+
+		for (const auto& [object, _] : state.internalEnumMap) {
+			Py_DECREF(object);
+		}
+
+		for (const auto& [_, pluginData] : _pluginsMap) {
+			if (pluginData.state == &state) {
 				Py_DECREF(pluginData.instance);
 				Py_DECREF(pluginData.module);
 			}
-
-			Py_Finalize();
 		}
-		_formatException = nullptr;
-		_ppsModule = nullptr;
-		_Vector2TypeObject = nullptr;
-		_Vector3TypeObject = nullptr;
-		_Vector4TypeObject = nullptr;
-		_Matrix4x4TypeObject = nullptr;
-		_ExtractRequiredModulesObject = nullptr;
-		_PluginTypeObject = nullptr;
-		_PluginInfoTypeObject = nullptr;
-		_internalMap.clear();
-		_externalMap.clear();
-		_internalFunctions.clear();
-		_externalFunctions.clear();
-		_externalEnumMap.clear();
-		_internalEnumMap.clear();
-		_moduleMethods.clear();
-		_moduleFunctions.clear();
-		_pythonMethods.clear();
-		_pluginsMap.clear();
-		_provider.reset();
+
+		ClearTypeCache();
+		ClearValueObjectTypes(state);
 	}
 
 	void Python3LanguageModule::TryCreateModule(const Extension& plugin, bool empty) {
-		PyObject* const moduleDict = PyModule_GetDict(_ppsModule);
-		if (PyObject* moduleObject = PyDict_GetItemString(moduleDict, plugin.GetName().c_str())) {
-			if (!empty || !IsEmptyModule(moduleObject)) {
-				return;
+		PyObject* const moduleDict = PyModule_GetDict(GetState().ppsModule);
+		if (PyObject* const existingObject = GetDictItemRef(moduleDict, plugin.GetName().c_str())) {
+			if (empty && IsEmptyModule(existingObject) && !CreateInternalModule(plugin, existingObject)) {
+				CreateExternalModule(plugin, existingObject);
 			}
-
-			if (!CreateInternalModule(plugin, moduleObject)) {
-				CreateExternalModule(plugin, moduleObject);
-			}
-
+			Py_DECREF(existingObject);
 		} else {
-			moduleObject = CreateInternalModule(plugin);
+			PyObject* moduleObject = CreateInternalModule(plugin);
 			if (!moduleObject) {
 				moduleObject = CreateExternalModule(plugin);
 			}
@@ -3455,7 +5644,11 @@ namespace py3lm {
 	}
 
 	void Python3LanguageModule::OnMethodExport(const Extension& plugin) {
-		TryCreateModule(plugin, true);
+		// Every interpreter has its own plugify.pps
+		for (const auto& state : _states) {
+			GILLock lock(*state);
+			TryCreateModule(plugin, true);
+		}
 	}
 
 	void Python3LanguageModule::ResolveRequiredModule(std::string_view moduleName) {
@@ -3468,7 +5661,7 @@ namespace py3lm {
 			if (plugin && plugin->GetState() == ExtensionState::Loaded) {
 				TryCreateModule(*plugin, false);
 			} else {
-				[[maybe_unused]] PyObject* const moduleDict = PyModule_GetDict(_ppsModule);
+				[[maybe_unused]] PyObject* const moduleDict = PyModule_GetDict(GetState().ppsModule);
 				PyObject* const moduleObject = PyModule_New(pluginName.data());
 				[[maybe_unused]] const auto res = PyDict_SetItemString(moduleDict, pluginName.data(), moduleObject);
 				assert(res == 0);
@@ -3479,7 +5672,13 @@ namespace py3lm {
 
 	std::vector<std::string> Python3LanguageModule::ExtractRequiredModules(const std::string& modulePath) {
 		std::vector<std::string> requiredModules;
-		PyObject* const result = PyObject_CallOneArg(_ExtractRequiredModulesObject, PyUnicode_FromString(modulePath.c_str()));
+
+		// Parsed imports are cached on disk, files already scanned this session are skipped
+		PyObject* const pathObject = PyUnicode_FromString(modulePath.c_str());
+		PyObject* const cacheDirObject = CreatePyObject(_provider->GetCacheDir());
+		PyObject* const result = pathObject && cacheDirObject ? PyObject_CallFunctionObjArgs(GetState().extractRequiredModules, pathObject, cacheDirObject, nullptr) : nullptr;
+		Py_XDECREF(pathObject);
+		Py_XDECREF(cacheDirObject);
 
 		if (result) {
 			if (PySet_Check(result)) {
@@ -3542,7 +5741,17 @@ namespace py3lm {
 
 		_provider->Log(std::format(LOG_PREFIX "Load plugin module '{}'", moduleName), Severity::Verbose);
 
-		GILLock lock{};
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+		auto stateResult = CreatePluginInterpreter();
+		if (!stateResult) {
+			return MakeError("Failed to create interpreter for '{}': {}", moduleName, stateResult.error());
+		}
+		InterpreterState& state = **stateResult;
+#else
+		InterpreterState& state = GetState();
+#endif
+
+		GILLock lock(state);
 
 		for (const auto& requiredModule : ExtractRequiredModules(plg::as_string(filePath))) {
 			ResolveRequiredModule(requiredModule);
@@ -3568,7 +5777,7 @@ namespace py3lm {
 			return MakeError("Failed to find plugin class");;
 		}
 
-		const int typeResult = PyObject_IsSubclass(pluginClass, _PluginTypeObject);
+		const int typeResult = PyObject_IsSubclass(pluginClass, state.pluginType);
 		if (typeResult != 1) {
 			Py_DECREF(pluginClass);
 			Py_DECREF(classNameString);
@@ -3632,7 +5841,7 @@ namespace py3lm {
 		Py_INCREF(pluginInstance);
 		PyTuple_SET_ITEM(args, Py_ssize_t{ 1 }, pluginInstance); // pluginInstance ref taken by list
 
-		PyObject* const pluginInfo = PyObject_CallObject(_PluginInfoTypeObject, args);
+		PyObject* const pluginInfo = PyObject_CallObject(state.pluginInfoType, args);
 		Py_DECREF(args);
 		if (!pluginInfo) {
 			Py_DECREF(pluginInstance);
@@ -3705,7 +5914,7 @@ namespace py3lm {
 			return MakeError("Invalid methods:\n{}", plg::join(exportErrors, "\n"));
 		}
 
-		const auto [it, result] = _pluginsMap.try_emplace(plugin.GetId(), pluginModule, pluginInstance, updatePlugin, startPlugin, endPlugin);
+		const auto [it, result] = _pluginsMap.try_emplace(plugin.GetId(), pluginModule, pluginInstance, updatePlugin, startPlugin, endPlugin, std::unordered_map<void*, PyObject*>{}, &state);
 		if (!result) {
 			Py_DECREF(pluginInstance);
 			Py_DECREF(pluginModule);
@@ -3714,40 +5923,160 @@ namespace py3lm {
 
 		std::vector<MethodData> methods;
 		methods.reserve(methodsHolders.size());
-		_pythonMethods.reserve(methodsHolders.size());
+		state.pythonMethods.reserve(state.pythonMethods.size() + methodsHolders.size());
+		it->second.methods.reserve(methodsHolders.size());
 
 		for (auto& [method, methodData] : methodsHolders) {
 			const MemAddr methodAddr = methodData.jitCallback.GetFunction();
 			methods.emplace_back(method, methodAddr);
 			AddToFunctionsMap(methodAddr, methodData.pythonFunction);
-			_pythonMethods.emplace_back(std::move(methodData));
+			it->second.methods.emplace(methodAddr, methodData.pythonFunction);
+			state.pythonMethods.emplace_back(std::move(methodData));
 		}
 
+#if PY3LM_BATCHED_UPDATE
+		// Updates run from OnUpdate, start and end are always requested to track which plugins are running
+		return LoadData{ std::move(methods), &it->second, { false, true, true, !exportedMethods.empty() } };
+#else
 		return LoadData{ std::move(methods), &it->second, { updatePlugin != nullptr, startPlugin != nullptr, endPlugin != nullptr, !exportedMethods.empty() } };
+#endif
+	}
+
+	void Python3LanguageModule::OnUpdate([[maybe_unused]] std::chrono::milliseconds dt) {
+#if PY3LM_BATCHED_UPDATE
+		if (_updates.empty()) {
+			return;
+		}
+
+		// One GIL acquisition and one dt object per interpreter, instead of one of each per plugin
+		const float deltaTime = std::chrono::duration<float>(dt).count();
+		std::optional<GILLock> lock;
+		InterpreterState* lockedState = nullptr;
+		PyObject* deltaObject = nullptr;
+
+		// An update may start or end other plugins: while _updating, ends only clear the entry and starts are
+		// queued, so _updates keeps its size and order until the loop is done
+		_updating = true;
+		for (const UpdateEntry& entry : _updates) {
+			if (!entry.update) {
+				continue;
+			}
+
+			InterpreterState* const state = entry.state;
+			if (state != lockedState) {
+				Py_XDECREF(deltaObject);
+				lock.reset();
+				lock.emplace(*state);
+				lockedState = state;
+				deltaObject = CreatePyObject(deltaTime);
+				if (!deltaObject) {
+					LogError();
+					lockedState = nullptr;
+					continue;
+				}
+			}
+
+			// Kept alive by its own reference in case the plugin ends during the call
+			PyObject* const update = Py_NewRef(entry.update);
+			PyObject* const returnObject = PyObject_CallOneArg(update, deltaObject);
+			Py_DECREF(update);
+			if (!returnObject) {
+				LogError();
+				_provider->Log(std::format(LOG_PREFIX "{}: call of 'plugin_update' failed", entry.name), Severity::Error);
+				continue;
+			}
+			Py_DECREF(returnObject);
+		}
+
+		Py_XDECREF(deltaObject);
+		lock.reset();
+		_updating = false;
+
+		std::erase_if(_updates, [](const UpdateEntry& entry) {
+			return !entry.update;
+		});
+		for (UpdateEntry& entry : _startedUpdates) {
+			AddUpdate(std::move(entry));
+		}
+		_startedUpdates.clear();
+#endif
 	}
 
+
+#if PY3LM_BATCHED_UPDATE
+	void Python3LanguageModule::AddUpdate(UpdateEntry entry) {
+		if (_updating) {
+			_startedUpdates.push_back(std::move(entry));
+			return;
+		}
+
+		// Next to the plugins of the same interpreter, so OnUpdate switches interpreters once per group
+		const auto last = std::find_if(_updates.rbegin(), _updates.rend(), [&](const UpdateEntry& other) {
+			return other.state == entry.state;
+		});
+		_updates.insert(last != _updates.rend() ? last.base() : _updates.end(), std::move(entry));
+	}
+#endif
+
 	void Python3LanguageModule::OnPluginStart(const Extension& plugin) {
-		GILLock lock{};
-		PyObject* const returnObject = PyObject_CallNoArgs(plugin.GetUserData().RCast<PluginData*>()->start);
-		if (!returnObject) {
-			LogError();
-			_provider->Log(std::format(LOG_PREFIX "{}: call of 'plugin_start' failed", plugin.GetName()), Severity::Error);
+		const PluginData& pluginData = *plugin.GetUserData().RCast<PluginData*>();
+		GILLock lock(*pluginData.state);
+		if (pluginData.start) {
+			PyObject* const returnObject = PyObject_CallNoArgs(pluginData.start);
+			if (!returnObject) {
+				LogError();
+				_provider->Log(std::format(LOG_PREFIX "{}: call of 'plugin_start' failed", plugin.GetName()), Severity::Error);
+			}
+		}
+
+#if PY3LM_BATCHED_UPDATE
+		if (pluginData.update) {
+			AddUpdate(UpdateEntry{ pluginData.update, pluginData.state, std::string(plugin.GetName()) });
 		}
+#endif
 	}
 
 	void Python3LanguageModule::OnPluginUpdate(const Extension& plugin, std::chrono::milliseconds dt) {
-		GILLock lock{};
+		const PluginData& pluginData = *plugin.GetUserData().RCast<PluginData*>();
+		GILLock lock(*pluginData.state);
 		PyObject* const deltaTime = CreatePyObject(std::chrono::duration<float>(dt).count());
-		PyObject* const returnObject = PyObject_CallOneArg(plugin.GetUserData().RCast<PluginData*>()->update, deltaTime);
+		PyObject* const returnObject = PyObject_CallOneArg(pluginData.update, deltaTime);
+		Py_XDECREF(deltaTime);
 		if (!returnObject) {
 			LogError();
 			_provider->Log(std::format(LOG_PREFIX "{}: call of 'plugin_update' failed", plugin.GetName()), Severity::Error);
+			return;
 		}
+		Py_DECREF(returnObject);
 	}
 
 	void Python3LanguageModule::OnPluginEnd(const Extension& plugin) {
-		GILLock lock{};
-		PyObject* const returnObject = PyObject_CallNoArgs(plugin.GetUserData().RCast<PluginData*>()->end);
+		ReleaseJitCalls(plugin);
+		const PluginData& pluginData = *plugin.GetUserData().RCast<PluginData*>();
+#if PY3LM_BATCHED_UPDATE
+		if (pluginData.update) {
+			std::erase_if(_startedUpdates, [&](const UpdateEntry& entry) {
+				return entry.update == pluginData.update;
+			});
+			if (_updating) {
+				// Skipped by the running OnUpdate loop and dropped after it
+				for (UpdateEntry& entry : _updates) {
+					if (entry.update == pluginData.update) {
+						entry.update = nullptr;
+					}
+				}
+			} else {
+				std::erase_if(_updates, [&](const UpdateEntry& entry) {
+					return entry.update == pluginData.update;
+				});
+			}
+		}
+#endif
+		if (!pluginData.end) {
+			return;
+		}
+		GILLock lock(*pluginData.state);
+		PyObject* const returnObject = PyObject_CallNoArgs(pluginData.end);
 		if (!returnObject) {
 			LogError();
 			_provider->Log(std::format(LOG_PREFIX "{}: call of 'plugin_end' failed", plugin.GetName()), Severity::Error);
@@ -3758,77 +6087,105 @@ namespace py3lm {
 		return PY3LM_IS_DEBUG;
 	}
 
+	// New reference, taken under the lock so a concurrent release can't drop the object first
 	PyObject* Python3LanguageModule::FindExternal(void* funcAddr) const {
-		const auto it = _externalMap.find(funcAddr);
-		if (it != _externalMap.end()) {
-			return std::get<PyObject*>(*it);
+		InterpreterState& state = GetState();
+		ReadLock lock(state.registryMutex);
+		const auto it = state.externalMap.find(funcAddr);
+		if (it != state.externalMap.end()) {
+			return Py_NewRef(std::get<PyObject*>(*it));
 		}
 		return nullptr;
 	}
 
 	void* Python3LanguageModule::FindInternal(PyObject* object) const {
-		const auto it = _internalMap.find(object);
-		if (it != _internalMap.end()) {
+		InterpreterState& state = GetState();
+		ReadLock lock(state.registryMutex);
+		const auto it = state.internalMap.find(object);
+		if (it != state.internalMap.end()) {
 			return std::get<void*>(*it);
 		}
 		return nullptr;
 	}
 
 	void Python3LanguageModule::AddToFunctionsMap(void* funcAddr, PyObject* object) {
-		_externalMap.emplace(funcAddr, object);
-		_internalMap.emplace(object, funcAddr);
+		InterpreterState& state = GetState();
+		WriteLock lock(state.registryMutex);
+		state.externalMap.emplace(funcAddr, object);
+		state.internalMap.emplace(object, funcAddr);
 	}
 
-	PyObject* Python3LanguageModule::GetOrCreateFunctionObject(const Method& method, void* funcAddr) {
-		if (PyObject* const object = FindExternal(funcAddr)) {
-			Py_INCREF(object);
-			return object;
+	PyObject* Python3LanguageModule::CreateExternalFunctionObject(const Method& method, MemAddr addr, const char* name, PyObject* moduleName) {
+		auto jitCall = GetOrCreateJitCall(method, addr);
+		if (!jitCall) {
+			// GetOrCreateJitCall set error
+			return nullptr;
 		}
-		JitCall call{};
 
-		const MemAddr callAddr = call.GetJitFunc(method, funcAddr);
-		if (!callAddr) {
-			const std::string error(std::format("Lang module JIT failed to generate c++ call wrapper '{}'", call.GetError()));
-			PyErr_SetString(PyExc_RuntimeError, error.c_str());
+		auto plan = CreateExternalCallPlan(method, jitCall->func);
+		plan->jitCall = std::move(jitCall);
+
+		auto defPtr = std::make_unique<PyMethodDef>();
+		defPtr->ml_name = name;
+
+		PyObject* const object = CreateExternalFunction(*defPtr, *plan, moduleName);
+		if (!object) {
+			PyErr_SetString(PyExc_RuntimeError, "Fail to create function object from function pointer");
 			return nullptr;
 		}
 
-		JitCallback callback{};
-
-		Signature sig{};
-		sig.AddArg(ValueType::Pointer);
-		sig.AddArg(ValueType::Pointer);
-		sig.SetRet(ValueType::Pointer);
+		Py_INCREF(object);
+		InterpreterState& state = GetState();
+		WriteLock lock(state.registryMutex);
+		state.externalFunctions.emplace_back(std::move(plan), std::move(defPtr), object);
 
-		const bool noArgs = method.GetParamTypes().empty();
+		return object;
+	}
 
-		const MemAddr methodAddr = callback.GetJitFunc(sig, &method, noArgs ? &ExternalCallNoArgs : &ExternalCall, callAddr, false);
-		if (!methodAddr) {
-			const std::string error(std::format("Lang module JIT failed to generate c++ PyCFunction wrapper '{}'", callback.GetError()));
-			PyErr_SetString(PyExc_RuntimeError, error.c_str());
+	PyObject* Python3LanguageModule::CreateReleasingFunctionObject(PyObject* function) {
+		const ExternalCallPlan* const source = FindExternalCallPlan(function);
+		if (!source) {
+			SetTypeError("Expected function exported by a native plugin", function);
 			return nullptr;
 		}
+		if (source->releaseGil) {
+			return Py_NewRef(function);
+		}
+
+		auto plan = std::make_unique<ExternalCallPlan>(*source);
+		plan->releaseGil = true;
 
 		auto defPtr = std::make_unique<PyMethodDef>();
-		PyMethodDef& def = *(defPtr);
-		def.ml_name = "PlugifyExternal";
-		def.ml_meth = methodAddr.RCast<PyCFunction>();
-		def.ml_flags = noArgs ? METH_NOARGS : METH_VARARGS;
-		def.ml_doc = nullptr;
+		defPtr->ml_name = plan->method->GetName().c_str();
 
-		PyObject* const object = PyCFunction_New(defPtr.get(), nullptr);
+		PyObject* const object = CreateExternalFunction(*defPtr, *plan, reinterpret_cast<PyCFunctionObject*>(function)->m_module);
 		if (!object) {
-			PyErr_SetString(PyExc_RuntimeError, "Fail to create function object from function pointer");
 			return nullptr;
 		}
 
 		Py_INCREF(object);
-		_externalFunctions.emplace_back(std::move(callback), std::move(call), std::move(defPtr), object);
-		AddToFunctionsMap(funcAddr, object);
+		InterpreterState& state = GetState();
+		WriteLock lock(state.registryMutex);
+		state.externalFunctions.emplace_back(std::move(plan), std::move(defPtr), object);
 
 		return object;
 	}
 
+	PyObject* Python3LanguageModule::GetOrCreateFunctionObject(const Method& method, void* funcAddr) {
+		if (PyObject* const object = FindExternal(funcAddr)) {
+			return object;
+		}
+
+		PyObject* const object = CreateExternalFunctionObject(method, funcAddr, "PlugifyExternal", nullptr);
+		if (object) {
+			AddToFunctionsMap(funcAddr, object);
+		}
+		return object;
+	}
+
+	// Released trampolines of a Method that must queue up before the oldest is reused
+	constexpr size_t kCallbackQuarantine = 16;
+
 	std::optional<void*> Python3LanguageModule::GetOrCreateFunctionValue(const Method& method, PyObject* object) {
 		if (object == Py_None) {
 			return nullptr;
@@ -3839,397 +6196,140 @@ namespace py3lm {
 			return std::nullopt;
 		}
 
-		if (void* const funcAddr = FindInternal(object)) {
-			return funcAddr;
-		}
+		if (void* const funcAddr = FindInternal(object)) {
+			return funcAddr;
+		}
+
+		InterpreterState& state = GetState();
+		WriteLock lock(state.registryMutex);
+		// Another thread may have passed the same callable meanwhile
+		if (const auto it = state.internalMap.find(object); it != state.internalMap.end()) {
+			return it->second;
+		}
+
+		void* funcAddr;
+
+		// A released trampoline of the same Method only needs its plan pointed at the new callable. The oldest one is
+		// taken and only once kCallbackQuarantine newer ones wait behind it, so a stale native pointer keeps failing
+		// safely for a while instead of immediately calling an unrelated callable.
+		const auto recycledIt = state.recycledFunctions.find(&method);
+		if (recycledIt != state.recycledFunctions.end() && recycledIt->second.size() > kCallbackQuarantine) {
+			PythonMethodData& data = recycledIt->second.front();
+			funcAddr = data.jitCallback.GetFunction();
+			data.pythonFunction = object;
+			data.plan->func = object;
+			state.internalFunctions.emplace(funcAddr, InterpreterState::CallbackHolder{ &method, std::move(data) });
+			recycledIt->second.pop_front();
+			--state.recycledCount;
+		} else {
+			auto plan = CreateInternalCallPlan(method, object, false);
+			auto [result, callback] = CreateInternalCall(method, *plan);
+
+			if (!result) {
+				const std::string error(std::format("Lang module JIT failed to generate C++ wrapper from callback object '{}'", callback.GetError()));
+				PyErr_SetString(PyExc_RuntimeError, error.c_str());
+				return std::nullopt;
+			}
+
+			funcAddr = callback.GetFunction();
+			state.internalFunctions.emplace(funcAddr, InterpreterState::CallbackHolder{ &method, PythonMethodData{ std::move(callback), object, std::move(plan) } });
+		}
+
+		Py_INCREF(object);
+		state.externalMap.emplace(funcAddr, object);
+		state.internalMap.emplace(object, funcAddr);
+
+		return funcAddr;
+	}
+
+	bool Python3LanguageModule::ReleaseFunctionValue(PyObject* object) {
+		InterpreterState& state = GetState();
+		{
+			WriteLock lock(state.registryMutex);
+			const auto it = state.internalMap.find(object);
+			if (it == state.internalMap.end()) {
+				return false;
+			}
+
+			void* const funcAddr = it->second;
+			// Exported plugin methods share the maps but are never released
+			const auto funcIt = state.internalFunctions.find(funcAddr);
+			if (funcIt == state.internalFunctions.end()) {
+				return false;
+			}
 
-		auto [result, callback] = CreateInternalCall(method, object);
+			state.internalMap.erase(it);
+			state.externalMap.erase(funcAddr);
 
-		if (!result) {
-			const std::string error(std::format("Lang module JIT failed to generate C++ wrapper from callback object '{}'", callback.GetError()));
-			PyErr_SetString(PyExc_RuntimeError, error.c_str());
-			return std::nullopt;
+			auto& [method, data] = funcIt->second;
+			data.pythonFunction = nullptr;
+			data.plan->func = nullptr;
+			state.recycledFunctions[method].push_back(std::move(data));
+			state.internalFunctions.erase(funcIt);
+			++state.recycledCount;
 		}
 
-		void* const funcAddr = callback.GetFunction();
-
-		Py_INCREF(object);
-		_internalFunctions.emplace_back(std::move(callback), object);
-		AddToFunctionsMap(funcAddr, object);
+		// Outside the lock, finalizers may call back into the module
+		Py_DECREF(object);
+		return true;
+	}
 
-		return funcAddr;
+	PythonCallbackCounts Python3LanguageModule::GetFunctionValueCounts() const {
+		InterpreterState& state = GetState();
+		ReadLock lock(state.registryMutex);
+		return { state.internalFunctions.size(), state.recycledCount };
 	}
 
 	PyObject* Python3LanguageModule::CreateVector2Object(const plg::vec2& vector) {
-		PyObject* const args = PyTuple_New(Py_ssize_t{ 2 });
-		if (!args) {
-			PyErr_SetString(PyExc_RuntimeError, "Fail to create arguments tuple");
-			return nullptr;
-		}
-		// CreatePyObject set error
-		PyObject* const xObject = CreatePyObject(vector.x);
-		if (!xObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 0 }, xObject); // xObject ref taken by tuple
-		PyObject* const yObject = CreatePyObject(vector.y);
-		if (!yObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 1 }, yObject); // yObject ref taken by tuple
-		PyObject* const vectorObject = PyObject_CallObject(_Vector2TypeObject, args);
-		Py_DECREF(args);
-		return vectorObject;
+		return CreateValueObject(vector);
 	}
 
 	std::optional<plg::vec2> Python3LanguageModule::Vector2ValueFromObject(PyObject* object) {
-		const int typeResult = PyObject_IsInstance(object, _Vector2TypeObject);
-		if (typeResult == -1) {
-			// Python exception was set by PyObject_IsInstance
-			return std::nullopt;
-		}
-		if (typeResult == 0) {
-			SetTypeError("Expected Vector2", object);
-			return std::nullopt;
-		}
-		auto xValue = GetObjectAttrAsValue<float>(object, "x");
-		if (!xValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		auto yValue = GetObjectAttrAsValue<float>(object, "y");
-		if (!yValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		return plg::vec2{ *xValue, *yValue };
+		return ValueFromValueObject<plg::vec2>(object);
 	}
 
 	PyObject* Python3LanguageModule::CreateVector3Object(const plg::vec3& vector) {
-		PyObject* const args = PyTuple_New(Py_ssize_t{ 3 });
-		if (!args) {
-			PyErr_SetString(PyExc_RuntimeError, "Fail to create arguments tuple");
-			return nullptr;
-		}
-		// CreatePyObject set error
-		PyObject* const xObject = CreatePyObject(vector.x);
-		if (!xObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 0 }, xObject); // xObject ref taken by tuple
-		PyObject* const yObject = CreatePyObject(vector.y);
-		if (!yObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 1 }, yObject); // yObject ref taken by tuple
-		PyObject* const zObject = CreatePyObject(vector.z);
-		if (!zObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 2 }, zObject); // zObject ref taken by tuple
-		PyObject* const vectorObject = PyObject_CallObject(_Vector3TypeObject, args);
-		Py_DECREF(args);
-		return vectorObject;
+		return CreateValueObject(vector);
 	}
 
 	std::optional<plg::vec3> Python3LanguageModule::Vector3ValueFromObject(PyObject* object) {
-		const int typeResult = PyObject_IsInstance(object, _Vector3TypeObject);
-		if (typeResult == -1) {
-			// Python exception was set by PyObject_IsInstance
-			return std::nullopt;
-		}
-		if (typeResult == 0) {
-			SetTypeError("Expected Vector3", object);
-			return std::nullopt;
-		}
-		auto xValue = GetObjectAttrAsValue<float>(object, "x");
-		if (!xValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		auto yValue = GetObjectAttrAsValue<float>(object, "y");
-		if (!yValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		auto zValue = GetObjectAttrAsValue<float>(object, "z");
-		if (!zValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		return plg::vec3{ *xValue, *yValue, *zValue };
+		return ValueFromValueObject<plg::vec3>(object);
 	}
 
 	PyObject* Python3LanguageModule::CreateVector4Object(const plg::vec4& vector) {
-		PyObject* const args = PyTuple_New(Py_ssize_t{ 4 });
-		if (!args) {
-			PyErr_SetString(PyExc_RuntimeError, "Fail to create arguments tuple");
-			return nullptr;
-		}
-		// CreatePyObject set error
-		PyObject* const xObject = CreatePyObject(vector.x);
-		if (!xObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 0 }, xObject); // xObject ref taken by tuple
-		PyObject* const yObject = CreatePyObject(vector.y);
-		if (!yObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 1 }, yObject); // yObject ref taken by tuple
-		PyObject* const zObject = CreatePyObject(vector.z);
-		if (!zObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 2 }, zObject); // zObject ref taken by tuple
-		PyObject* const wObject = CreatePyObject(vector.w);
-		if (!wObject) {
-			Py_DECREF(args);
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 3 }, wObject); // wObject ref taken by tuple
-		PyObject* const vectorObject = PyObject_CallObject(_Vector4TypeObject, args);
-		Py_DECREF(args);
-		return vectorObject;
+		return CreateValueObject(vector);
 	}
 
 	std::optional<plg::vec4> Python3LanguageModule::Vector4ValueFromObject(PyObject* object) {
-		const int typeResult = PyObject_IsInstance(object, _Vector4TypeObject);
-		if (typeResult == -1) {
-			// Python exception was set by PyObject_IsInstance
-			return std::nullopt;
-		}
-		if (typeResult == 0) {
-			SetTypeError("Expected Vector4", object);
-			return std::nullopt;
-		}
-		auto xValue = GetObjectAttrAsValue<float>(object, "x");
-		if (!xValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		auto yValue = GetObjectAttrAsValue<float>(object, "y");
-		if (!yValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		auto zValue = GetObjectAttrAsValue<float>(object, "z");
-		if (!zValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		auto wValue = GetObjectAttrAsValue<float>(object, "w");
-		if (!wValue) {
-			// GetObjectAttrAsValue set error. e.g. AttributeError, TypeError, ValueError
-			return std::nullopt;
-		}
-		return plg::vec4{ *xValue, *yValue, *zValue, *wValue };
+		return ValueFromValueObject<plg::vec4>(object);
 	}
 
 	PyObject* Python3LanguageModule::CreateMatrix4x4Object(const plg::mat4x4& matrix) {
-		PyObject* const elementsObject = PyList_New(Py_ssize_t{ 16 });
-		if (!elementsObject) {
-			PyErr_SetString(PyExc_RuntimeError, "Fail to create Matrix4x4 elements list");
-			return nullptr;
-		}
-		// CreatePyObject set error
-		PyObject* const m00Object = CreatePyObject(matrix.m00);
-		if (!m00Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 0 }, m00Object); // m00Object ref taken by list
-		PyObject* const m01Object = CreatePyObject(matrix.m01);
-		if (!m01Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 1 }, m01Object); // m01Object ref taken by list
-		PyObject* const m02Object = CreatePyObject(matrix.m02);
-		if (!m02Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 2 }, m02Object); // m02Object ref taken by list
-		PyObject* const m03Object = CreatePyObject(matrix.m03);
-		if (!m03Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 3 }, m03Object); // m03Object ref taken by list
-		PyObject* const m10Object = CreatePyObject(matrix.m10);
-		if (!m10Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 4 }, m10Object); // m10Object ref taken by list
-		PyObject* const m11Object = CreatePyObject(matrix.m11);
-		if (!m11Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 5 }, m11Object); // m11Object ref taken by list
-		PyObject* const m12Object = CreatePyObject(matrix.m12);
-		if (!m12Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 6 }, m12Object); // m12Object ref taken by list
-		PyObject* const m13Object = CreatePyObject(matrix.m13);
-		if (!m13Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 7 }, m13Object); // m13Object ref taken by list
-		PyObject* const m20Object = CreatePyObject(matrix.m20);
-		if (!m20Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 8 }, m20Object); // m20Object ref taken by list
-		PyObject* const m21Object = CreatePyObject(matrix.m21);
-		if (!m21Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 9 }, m21Object); // m21Object ref taken by list
-		PyObject* const m22Object = CreatePyObject(matrix.m22);
-		if (!m22Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 10 }, m22Object); // m22Object ref taken by list
-		PyObject* const m23Object = CreatePyObject(matrix.m23);
-		if (!m23Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 11 }, m23Object); // m23Object ref taken by list
-		PyObject* const m30Object = CreatePyObject(matrix.m30);
-		if (!m30Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 12 }, m30Object); // m30Object ref taken by list
-		PyObject* const m31Object = CreatePyObject(matrix.m31);
-		if (!m31Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 13 }, m31Object); // m31Object ref taken by list
-		PyObject* const m32Object = CreatePyObject(matrix.m32);
-		if (!m32Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 14 }, m32Object); // m32Object ref taken by list
-		PyObject* const m33Object = CreatePyObject(matrix.m33);
-		if (!m33Object) {
-			Py_DECREF(elementsObject);
-			return nullptr;
-		}
-		PyList_SET_ITEM(elementsObject, Py_ssize_t{ 15 }, m33Object); // m33Object ref taken by list
-		PyObject* const args = PyTuple_New(Py_ssize_t{ 1 });
-		if (!args) {
-			Py_DECREF(elementsObject);
-			PyErr_SetString(PyExc_RuntimeError, "Fail to create arguments tuple");
-			return nullptr;
-		}
-		PyTuple_SET_ITEM(args, Py_ssize_t{ 0 }, elementsObject); // elementsObject ref taken by tuple
-		PyObject* const vectorObject = PyObject_CallObject(_Matrix4x4TypeObject, args);
-		Py_DECREF(args);
-		return vectorObject;
+		return CreateValueObject(matrix);
 	}
 
 	std::optional<plg::mat4x4> Python3LanguageModule::Matrix4x4ValueFromObject(PyObject* object) {
-		const int typeResult = PyObject_IsInstance(object, _Matrix4x4TypeObject);
-		if (typeResult == -1) {
-			// Python exception was set by PyObject_IsInstance
-			return std::nullopt;
-		}
-		if (typeResult == 0) {
-			SetTypeError("Expected Matrix4x4", object);
-			return std::nullopt;
-		}
-		PyObject* const elementsListObject = PyObject_GetAttrString(object, "m");
-		if (!elementsListObject) {
-			// PyObject_GetAttrString set error. e.g. AttributeError
-			return std::nullopt;
-		}
-		if (!PyList_CheckExact(elementsListObject)) {
-			Py_DECREF(elementsListObject);
-			PyErr_SetString(PyExc_ValueError, "Elements must be a 4x4 list");
-			return std::nullopt;
-		}
-		if (PyList_Size(elementsListObject) != Py_ssize_t{ 4 }) {
-			Py_DECREF(elementsListObject);
-			PyErr_SetString(PyExc_ValueError, "Elements must be a 4x4 list");
-			return std::nullopt;
-		}
-		plg::mat4x4 matrix{};
-		for (Py_ssize_t i = 0; i < Py_ssize_t{ 4 }; ++i) {
-			PyObject* const elementsRowListObject = PyList_GetItem(elementsListObject, i);
-			if (!elementsRowListObject) [[unlikely]] {
-				Py_DECREF(elementsListObject);
-				// PyList_GetItem set error. e.g. IndexError
-				return std::nullopt;
-			}
-			if (!PyList_CheckExact(elementsRowListObject)) {
-				Py_DECREF(elementsListObject);
-				PyErr_SetString(PyExc_ValueError, "Elements must be a 4x4 list");
-				return std::nullopt;
-			}
-			if (PyList_Size(elementsRowListObject) != Py_ssize_t{ 4 }) {
-				Py_DECREF(elementsListObject);
-				PyErr_SetString(PyExc_ValueError, "Elements must be a 4x4 list");
-				return std::nullopt;
-			}
-			for (Py_ssize_t j = 0; j < Py_ssize_t{ 4 }; ++j) {
-				PyObject* const mObject = PyList_GetItem(elementsRowListObject, j);
-				if (!mObject) [[unlikely]] {
-					Py_DECREF(elementsListObject);
-					/// PyList_GetItem set error. e.g. IndexError
-					return std::nullopt;
-				}
-				const auto mValue = ValueFromObject<float>(mObject);
-				if (!mValue) {
-					Py_DECREF(elementsListObject);
-					// ValueFromObject set error. e.g. TypeError
-					return std::nullopt;
-				}
-				matrix.data[static_cast<size_t>(i * Py_ssize_t{ 4 } + j)] = *mValue;
-			}
-		}
-		return matrix;
+		return ValueFromValueObject<plg::mat4x4>(object);
 	}
 
-	PyObject* Python3LanguageModule::FindPythonMethod(MemAddr addr) const {
-		for (const auto& data : _pythonMethods) {
-			if (data.jitCallback.GetFunction() == addr) {
-				return data.pythonFunction;
-			}
-		}
-		return nullptr;
+	PyObject* Python3LanguageModule::FindPythonMethod(const PluginData& pluginData, MemAddr addr) {
+		const auto it = pluginData.methods.find(addr);
+		return it != pluginData.methods.end() ? it->second : nullptr;
 	}
 
 	PyObject* Python3LanguageModule::CreateInternalModule(const Extension& plugin, PyObject* module) {
-		if (!_pluginsMap.contains(plugin.GetId())) {
+		// Functions of a plugin in another interpreter are only reachable through their native entry points
+		const auto pluginIt = _pluginsMap.find(plugin.GetId());
+		if (pluginIt == _pluginsMap.end() || pluginIt->second.state != &GetState()) {
 			return nullptr;
 		}
+		const PluginData& pluginData = pluginIt->second;
 
 		PyObject* const moduleObject = module ? module : PyModule_New(plugin.GetName().c_str());
 		PyObject* const moduleDict = PyModule_GetDict(moduleObject);
 
 		for (const auto& [method, addr] : plugin.GetMethodsData()) {
-			PyObject* const methodObject = FindPythonMethod(addr);
+			PyObject* const methodObject = FindPythonMethod(pluginData, addr);
 			if (!methodObject) {
 				_provider->Log(std::format(LOG_PREFIX "Not found '{}' method while CreateInternalModule for '{}' plugin", method.GetName(), plugin.GetName()), Severity::Fatal);
 				std::terminate();
@@ -4242,138 +6342,292 @@ namespace py3lm {
 		return moduleObject;
 	}
 
-	PyObject* Python3LanguageModule::CreateExternalModule(const Extension& plugin, PyObject* module) {
-		auto& moduleMethods = _moduleMethods.emplace_back();
-
-		for (const auto& [method, addr] : plugin.GetMethodsData()) {
-			JitCall call{};
-
-			const MemAddr callAddr = call.GetJitFunc(method, addr);
-			if (!callAddr) {
-				const std::string error(std::format("Lang module JIT failed to generate c++ call wrapper '{}'", call.GetError()));
-				PyErr_SetString(PyExc_RuntimeError, error.c_str());
-				return nullptr;
-			}
-
-			JitCallback callback{};
-
-			Signature sig{};
-			sig.AddArg(ValueType::Pointer);
-			sig.AddArg(ValueType::Pointer);
-			sig.SetRet(ValueType::Pointer);
-
-			const bool noArgs = method.GetParamTypes().empty();
-
-			// Generate function --> PyObject* (MethodPyCall*)(PyObject* self, PyObject* args)
-			const MemAddr methodAddr = callback.GetJitFunc(sig, &method, noArgs ? &ExternalCallNoArgs : &ExternalCall, callAddr, false);
-			if (!methodAddr)
-				break;
-
-			PyMethodDef& def = moduleMethods.emplace_back();
-			def.ml_name = method.GetName().c_str();
-			def.ml_meth = methodAddr.RCast<PyCFunction>();
-			def.ml_flags = noArgs ? METH_NOARGS : METH_VARARGS;
-			def.ml_doc = nullptr;
+	// Signatures share one JIT call wrapper per target, the python side has no generated code at all
+	std::shared_ptr<Python3LanguageModule::JitCallHolder> Python3LanguageModule::GetOrCreateJitCall(const Method& method, MemAddr addr) {
+		std::lock_guard lock(_jitCallsMutex);
+		const auto [it, inserted] = _jitCalls.try_emplace({ addr, GetJitSignature(method) });
+		if (!inserted) {
+			return it->second;
+		}
 
-			_moduleFunctions.emplace_back(std::move(callback), std::move(call));
+		auto holder = std::make_shared<JitCallHolder>();
+		holder->func = holder->jitCall.GetJitFunc(method, addr);
+		if (!holder->func) {
+			const std::string error(std::format("Lang module JIT failed to generate c++ call wrapper '{}'", holder->jitCall.GetError()));
+			PyErr_SetString(PyExc_RuntimeError, error.c_str());
+			_jitCalls.erase(it);
+			return {};
 		}
+		it->second = holder;
+		return holder;
+	}
 
-		{
-			PyMethodDef& def = moduleMethods.emplace_back();
-			def.ml_name = nullptr;
-			def.ml_meth = nullptr;
-			def.ml_flags = 0;
-			def.ml_doc = nullptr;
+	// Function objects made from the plugin's exports keep their wrappers, later lookups of these addresses generate new ones
+	void Python3LanguageModule::ReleaseJitCalls(const Extension& plugin) {
+		std::lock_guard lock(_jitCallsMutex);
+		for (const auto& [method, addr] : plugin.GetMethodsData()) {
+			_jitCalls.erase({ addr, GetJitSignature(method) });
 		}
+	}
 
+	// Methods are bound on first access, the module only keeps a name table until then
+	PyObject* Python3LanguageModule::CreateExternalModule(const Extension& plugin, PyObject* module) {
 		PyObject* const moduleObject = module ? module : PyModule_New(plugin.GetName().c_str());
+		if (!moduleObject) {
+			return nullptr;
+		}
 		PyObject* const moduleDict = PyModule_GetDict(moduleObject);
 
-		PyModule_AddFunctions(moduleObject, moduleMethods.data());
+		LazyAttributes* const lazy = GetOrCreateLazyAttributes(moduleDict);
+		if (lazy) {
+			for (const auto& [method, addr] : plugin.GetMethodsData()) {
+				{
+					// A placeholder module may already be read through __getattr__ by another thread
+					WriteLock lock(lazy->mutex);
+					if (lazy->methods.try_emplace(method.GetName(), &method, addr).second) {
+						++lazy->methodCount;
+					}
+				}
+				GenerateEnum(method, moduleDict);
+			}
+			if (!SetLazyAll(moduleDict, *lazy)) {
+				LogError();
+			}
+			return moduleObject;
+		}
 
-		for (const auto& [method, _] : plugin.GetMethodsData()) {
+		// Module defines its own __getattr__, bind everything now
+		PyObject* const moduleName = PyModule_GetNameObject(moduleObject);
+		for (const auto& [method, addr] : plugin.GetMethodsData()) {
+			PyObject* const function = CreateExternalFunctionObject(method, addr, method.GetName().c_str(), moduleName);
+			if (!function) {
+				Py_XDECREF(moduleName);
+				if (!module) {
+					Py_DECREF(moduleObject);
+				}
+				return nullptr;
+			}
+			[[maybe_unused]] const auto res = PyDict_SetItemString(moduleDict, method.GetName().c_str(), function);
+			assert(res == 0);
+			Py_DECREF(function);
 			GenerateEnum(method, moduleDict);
 		}
+		Py_XDECREF(moduleName);
 
 		return moduleObject;
 	}
 
-	void Python3LanguageModule::CreateEnumObject(const EnumObject& enumerator, PyObject* moduleDict) {
-		PyObject* enumClass = PyDict_GetItemString(moduleDict, enumerator.GetName().c_str());
-		if (enumClass) {
-			const auto it = _internalEnumMap.find(enumClass);
-			if (it != _internalEnumMap.end()) {
-				_externalEnumMap.try_emplace(&enumerator, it->second);
+	// Classes are created on first use and shared by every module which references the enum
+	const PythonEnumMap* Python3LanguageModule::GetEnumMap(const EnumObject& enumerator) {
+		InterpreterState& state = GetState();
+		{
+			ReadLock lock(state.registryMutex);
+			const auto it = state.externalEnumMap.find(&enumerator);
+			if (it != state.externalEnumMap.end()) {
+				return it->second.get();
 			}
-			return;
 		}
 
 		const auto& values = enumerator.GetValues();
 		if (values.empty()) {
-			return;
+			return nullptr;
 		}
 
-		PyObject* constantsDict = PyDict_New();
+		PyObject* const constantsDict = PyDict_New();
+		if (!constantsDict) {
+			return nullptr;
+		}
 		for (const auto& value : values) {
-			[[maybe_unused]] const auto res = PyDict_SetItemString(constantsDict, value.GetName().c_str(), PyLong_FromLongLong(value.GetValue()));
+			PyObject* const valueObject = PyLong_FromLongLong(value.GetValue());
+			[[maybe_unused]] const auto res = PyDict_SetItemString(constantsDict, value.GetName().c_str(), valueObject);
 			assert(res == 0);
+			Py_XDECREF(valueObject);
 		}
 
-		enumClass = PyObject_CallMethod(_enumModule, "IntEnum", "sO", enumerator.GetName().c_str(), constantsDict);
+		PyObject* const enumClass = PyObject_CallMethod(state.enumModule, "IntEnum", "sO", enumerator.GetName().c_str(), constantsDict);
 
 		Py_DECREF(constantsDict);
 
-		if (enumClass && PyDict_SetItemString(moduleDict, enumerator.GetName().c_str(), enumClass) < 0) {
-			LogError();
-			Py_DECREF(enumClass);
+		if (!enumClass) {
+			return nullptr;
+		}
+
+		std::map<int64_t, PyObject*> members;
+		for (const auto& value : values) {
+			const int64_t i = value.GetValue();
+			if (members.contains(i)) {
+				continue;
+			}
+			PyObject* const valueObject = CreatePyObject(i);
+			PyObject* const member = PyObject_CallOneArg(enumClass, valueObject);
+			Py_DECREF(valueObject);
+			if (!member) {
+				for (const auto& [_, object] : members) {
+					Py_DECREF(object);
+				}
+				Py_DECREF(enumClass);
+				return nullptr;
+			}
+			members.emplace(i, member);
+		}
+
+		// A class built by a thread which lost the race is still owned by internalEnumMap, but never handed out
+		auto enumMap = std::make_shared<PythonEnumMap>(enumClass, std::move(members));
+		WriteLock lock(state.registryMutex);
+		const auto [it, _] = state.externalEnumMap.try_emplace(&enumerator, enumMap);
+		state.internalEnumMap.emplace(enumClass, std::move(enumMap));
+		return it->second.get();
+	}
+
+	PyObject* Python3LanguageModule::GetEnumClass(const EnumObject& enumerator) {
+		const PythonEnumMap* const enumMap = GetEnumMap(enumerator);
+		return enumMap ? enumMap->GetClass() : nullptr;
+	}
+
+	// Lazily bound pps modules resolve the name in their __getattr__ on first access. Any other module, the plugin's
+	// own one included, gets the class now: bare global lookups never reach a module __getattr__.
+	void Python3LanguageModule::BindEnumObject(const EnumObject& enumerator, PyObject* moduleDict) {
+		const std::string& name = enumerator.GetName();
+		if (HasDictItem(moduleDict, name.c_str())) {
 			return;
 		}
 
-		auto it = _externalEnumMap.find(&enumerator);
-		if (it == _externalEnumMap.end()) {
-			it = _externalEnumMap.emplace(&enumerator, std::make_shared<PythonEnumMap>()).first;
+		if (LazyAttributes* const lazy = FindLazyAttributes(moduleDict)) {
+			WriteLock lock(lazy->mutex);
+			lazy->enums.try_emplace(name, &enumerator);
+			return;
 		}
 
-		auto& enumMap = it->second;
-		for (const auto& value : values) {
-			const int64_t i = value.GetValue();
-			(*enumMap)[i] = PyObject_CallOneArg(enumClass, CreatePyObject(i));
+		PyObject* const enumClass = GetEnumClass(enumerator);
+		if (!enumClass || PyDict_SetItemString(moduleDict, name.c_str(), enumClass) < 0) {
+			LogError();
+		}
+	}
+
+	PythonEnumMap::PythonEnumMap(PyObject* enumClass, std::map<int64_t, PyObject*> members) : _class(enumClass) {
+		if (members.empty()) {
+			return;
+		}
+		_fallback = members.begin()->second;
+		_min = members.begin()->first;
+		const auto span = static_cast<uint64_t>(members.rbegin()->first) - static_cast<uint64_t>(_min);
+		// Flags and other sparse enums would waste memory, keep the table at least half full
+		if (span < std::max<uint64_t>(2 * members.size(), 64)) {
+			_dense.resize(static_cast<size_t>(span) + 1, nullptr);
+			for (const auto& [value, object] : members) {
+				_dense[static_cast<size_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(_min))] = object;
+			}
+		} else {
+			_sparse = std::move(members);
 		}
+	}
 
-		_internalEnumMap.try_emplace(enumClass, enumMap);
+	PyObject* PythonEnumMap::Find(int64_t value) const {
+		if (!_dense.empty()) {
+			const uint64_t index = static_cast<uint64_t>(value) - static_cast<uint64_t>(_min);
+			if (index < _dense.size() && _dense[static_cast<size_t>(index)]) {
+				return _dense[static_cast<size_t>(index)];
+			}
+			return _fallback;
+		}
+		const auto it = _sparse.find(value);
+		return it != _sparse.end() ? it->second : _fallback;
 	}
 
-	PyObject* Python3LanguageModule::GetEnumObject(const EnumObject& enumerator, int64_t value) const {
-		const auto it1 = _externalEnumMap.find(&enumerator);
-		if (it1 != _externalEnumMap.end()) {
-			PyObject* object;
-			const auto it2 = it1->second->find(static_cast<int64_t>(value));
-			if (it2 != it1->second->end()) {
-				object = it2->second;
-			} else {
-				object = it1->second->begin()->second;
+	PyObject* Python3LanguageModule::GetEnumObject(const EnumObject& enumerator, int64_t value) {
+		const PythonEnumMap* const enumMap = GetEnumMap(enumerator);
+		if (!enumMap) {
+			if (!PyErr_Occurred()) {
+				PyErr_SetString(PyExc_ValueError, "Invalid enum");
 			}
-			Py_INCREF(object);
-			return object;
+			return nullptr;
 		}
-		PyErr_SetString(PyExc_ValueError, "Invalid enum");
-		return nullptr;
+		PyObject* const object = enumMap->Find(value);
+		Py_INCREF(object);
+		return object;
+	}
+
+	bool Python3LanguageModule::IsEnumObject(PyObject* object) const {
+		const InterpreterState& state = GetState();
+		return state.enumType && PyObject_TypeCheck(object, reinterpret_cast<PyTypeObject*>(state.enumType));
 	}
 
 	PythonType Python3LanguageModule::GetObjectType(PyObject* object) const {
 		PyTypeObject* const pytype = Py_TYPE(object);
-		auto it = _typeMap.find(pytype);
-		if (it != _typeMap.end()) {
-			return std::get<PythonType>(*it);
-		}
-		const char* name;
-		if (pytype != nullptr) {
-			PyObject* const typeName = PyType_GetName(pytype);
-			name = PyUnicode_AsUTF8(typeName);
-		} else {
-			name = "Invalid";
+
+		// Exact types which marshalling sees the most
+		if (pytype == &PyLong_Type) {
+			return { PyAbstractType::Long, "Long" };
+		}
+		if (pytype == &PyFloat_Type) {
+			return { PyAbstractType::Float, "Float" };
+		}
+		if (pytype == &PyUnicode_Type) {
+			return { PyAbstractType::Unicode, "Unicode" };
+		}
+		if (pytype == &PyBool_Type) {
+			return { PyAbstractType::Bool, "Bool" };
+		}
+		if (pytype == &PyList_Type) {
+			return { PyAbstractType::List, "List" };
+		}
+
+		const InterpreterState& state = GetState();
+		const auto findType = [&state](PyTypeObject* type) {
+			PythonType pythonType{ PyAbstractType::Invalid, nullptr };
+			if (const auto it = state.typeMap.find(type); it != state.typeMap.end()) {
+				pythonType = it->second;
+			}
+#if PY3LM_MARSHAL_SUBCLASSES
+			else {
+				// Subclasses of int, str and list (IntEnum members, StrEnum members, ...) marshal like their base
+				const unsigned long flags = PyType_GetFlags(type);
+				if (flags & Py_TPFLAGS_LONG_SUBCLASS) {
+					pythonType.type = PyAbstractType::Long;
+				} else if (flags & Py_TPFLAGS_UNICODE_SUBCLASS) {
+					pythonType.type = PyAbstractType::Unicode;
+				} else if (flags & Py_TPFLAGS_LIST_SUBCLASS) {
+					pythonType.type = PyAbstractType::List;
+				}
+			}
+#endif
+			return pythonType;
+		};
+
+#ifdef Py_GIL_DISABLED
+		// Cache slots are replaced in place and threads would race on them, the map is read-only after setup
+		const PythonType pythonType = findType(pytype);
+#else
+		// Fibonacci hashing spreads type objects which sit a fixed stride apart in the interpreter image
+		const auto slot = static_cast<size_t>((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pytype)) * 0x9E3779B97F4A7C15ULL) >> 58);
+		InterpreterState::TypeCacheEntry& entry = GetState().typeCache[slot];
+		if (entry.type != pytype) {
+			// Heap types are kept alive while cached, so their address can't be reused by another type
+			PyTypeObject* const evicted = entry.type;
+			entry.type = pytype;
+			entry.pythonType = findType(pytype);
+			if (PyType_HasFeature(pytype, Py_TPFLAGS_HEAPTYPE)) {
+				Py_INCREF(pytype);
+			}
+			if (evicted && PyType_HasFeature(evicted, Py_TPFLAGS_HEAPTYPE)) {
+				Py_DECREF(evicted);
+			}
+		}
+		const PythonType& pythonType = entry.pythonType;
+#endif
+		if (!pythonType.name) {
+			return { pythonType.type, pytype->tp_name };
+		}
+		return pythonType;
+	}
+
+	void Python3LanguageModule::ClearTypeCache() {
+		for (auto& entry : GetState().typeCache) {
+			if (entry.type && PyType_HasFeature(entry.type, Py_TPFLAGS_HEAPTYPE)) {
+				Py_DECREF(entry.type);
+			}
+			entry = {};
 		}
-		return { PyAbstractType::Invalid, name };
 	}
 
 	void Python3LanguageModule::LogError() const {
@@ -4388,7 +6642,7 @@ namespace py3lm {
 			ptraceback = Py_None;
 		}
 		PyErr_NormalizeException(&ptype, &pvalue, &ptraceback);
-		PyObject* strList = PyObject_CallFunctionObjArgs(_formatException, ptype, pvalue, ptraceback, nullptr);
+		PyObject* strList = PyObject_CallFunctionObjArgs(GetState().formatException, ptype, pvalue, ptraceback, nullptr);
 		Py_DECREF(ptype);
 		Py_DECREF(pvalue);
 		Py_DECREF(ptraceback);
@@ -4418,6 +6672,53 @@ namespace py3lm {
 		_provider->Log(result, Severity::Error);
 	}
 
+	InterpreterState& Python3LanguageModule::GetState() const {
+#if PY3LM_PLUGIN_SUBINTERPRETERS
+		// The current interpreter comes from the thread state, its InterpreterState is cached per thread
+		PyInterpreterState* const interpreter = PyInterpreterState_Get();
+		CachedState& cached = t_cachedState;
+		if (cached.interpreter == interpreter && cached.generation == _statesGeneration) {
+			return *cached.state;
+		}
+
+		std::lock_guard lock(_statesMutex);
+		for (const auto& state : _states) {
+			if (state->interpreter == interpreter) {
+				cached = { interpreter, state.get(), _statesGeneration };
+				return *state;
+			}
+		}
+
+		LogFatal(LOG_PREFIX "Python interpreter is not managed by the language module");
+		std::terminate();
+#else
+		return *_states.front();
+#endif
+	}
+
+	// Thread states are reused by later calls from the same thread and deleted with their interpreter
+	PyThreadState* Python3LanguageModule::GetThreadState(InterpreterState& state) {
+		ThreadStateCache& cache = t_threadStates;
+		if (cache.generation != _statesGeneration) {
+			cache.generation = _statesGeneration;
+			cache.threadStates.clear();
+		}
+		for (const auto& [interpreter, threadState] : cache.threadStates) {
+			if (interpreter == state.interpreter) {
+				return threadState;
+			}
+		}
+
+		PyThreadState* threadState = state.threadState;
+		if (!threadState || threadState->thread_id != PyThread_get_thread_ident()) {
+			threadState = PyThreadState_New(state.interpreter);
+			std::lock_guard lock(_statesMutex);
+			state.threadStates.push_back(threadState);
+		}
+		cache.threadStates.emplace_back(state.interpreter, threadState);
+		return threadState;
+	}
+
 	void Python3LanguageModule::LogFatal(std::string_view msg) const {
 		_provider->Log(msg, Severity::Fatal);
 	}
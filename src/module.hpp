@@ -7,12 +7,17 @@
 #include <plg/numerics.hpp>
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 using namespace plugify;
 
@@ -103,13 +108,89 @@ namespace py3lm {
 	using PythonInternalMap = std::unordered_map<PyObject*, void*>;
 	using PythonExternalMap = std::unordered_map<void*, PyObject*>;
 	using PythonTypeMap = std::unordered_map<PyTypeObject*, PythonType>;
-	using PythonEnumMap = std::map<int64_t, PyObject*>;
+	// Generated enum class and its members. Values of a contiguous (or nearly so) enum are indexed
+	// by value - min, sparse enums keep an ordered map. Unknown values map to the lowest member.
+	class PythonEnumMap {
+	public:
+		PythonEnumMap(PyObject* enumClass, std::map<int64_t, PyObject*> members);
+		PyObject* Find(int64_t value) const;
+		PyObject* GetClass() const { return _class; }
+
+	private:
+		PyObject* _class{};
+		int64_t _min{};
+		std::vector<PyObject*> _dense;
+		std::map<int64_t, PyObject*> _sparse;
+		PyObject* _fallback{};
+	};
 	using PythonExternalEnumMap = std::unordered_map<const EnumObject*, std::shared_ptr<PythonEnumMap>>;
 	using PythonInternalEnumMap = std::unordered_map<PyObject*, std::shared_ptr<PythonEnumMap>>;
 
+	struct InternalCallPlan;
+	struct ExternalCallPlan;
+
 	struct PythonMethodData {
 		JitCallback jitCallback;
 		PyObject* pythonFunction{};
+		std::unique_ptr<InternalCallPlan> plan;
+	};
+
+	struct PythonCallbackCounts {
+		size_t live;
+		size_t recycled;
+	};
+
+	// Python objects owned by one interpreter. There is only the main one, unless PY3LM_PLUGIN_SUBINTERPRETERS
+	// gives every plugin its own, in which case objects of one state must never reach another.
+	struct InterpreterState {
+		PyInterpreterState* interpreter{};
+		PyThreadState* threadState{}; // of the host thread, other threads get theirs on first entry
+		std::vector<PyThreadState*> threadStates; // created for other threads, deleted with the interpreter
+		PyObject* pluginType{};
+		PyObject* pluginInfoType{};
+		PyObject* vector2Type{};
+		PyObject* vector3Type{};
+		PyObject* vector4Type{};
+		PyObject* matrix4x4Type{};
+		PyObject* extractRequiredModules{};
+		PyObject* ppsModule{};
+		PyObject* enumModule{};
+		PyObject* enumType{};
+		PyObject* formatException{};
+		// Native value types of '_plugify' and their free lists, indexed vec2, vec3, vec4, mat4x4
+		std::array<PyTypeObject*, 4> valueTypes{};
+		std::array<std::vector<PyObject*>, 4> valueFreeLists;
+		PyTypeObject* arrayViewType{};
+		PyTypeObject* matrixViewType{};
+		// Guards the tables below in free-threaded builds, where the GIL no longer does
+		std::shared_mutex registryMutex;
+		std::vector<PythonMethodData> pythonMethods;
+		struct ExternalHolder {
+			std::unique_ptr<ExternalCallPlan> plan;
+			std::unique_ptr<PyMethodDef> def;
+			PyObject* object;
+		};
+		std::vector<ExternalHolder> externalFunctions;
+		struct CallbackHolder {
+			const Method* method;
+			PythonMethodData data;
+		};
+		std::unordered_map<void*, CallbackHolder> internalFunctions; // callables passed to C++ by JIT address
+		// Released trampolines by the Method they were generated for, oldest first. Plans point into that Method
+		// (enums, nested prototypes), so trampolines of equal signatures from different Methods are not shared.
+		std::unordered_map<const Method*, std::deque<PythonMethodData>> recycledFunctions;
+		size_t recycledCount = 0;
+		PythonExternalMap externalMap;
+		PythonInternalMap internalMap;
+		PythonTypeMap typeMap;
+		// Direct mapped classification cache, entries without a name report tp_name. Unused in free-threaded builds.
+		struct TypeCacheEntry {
+			PyTypeObject* type;
+			PythonType pythonType;
+		};
+		std::array<TypeCacheEntry, 64> typeCache{};
+		PythonExternalEnumMap externalEnumMap;
+		PythonInternalEnumMap internalEnumMap;
 	};
 
 	class Python3LanguageModule final : public ILanguageModule {
@@ -120,7 +201,7 @@ namespace py3lm {
 		// ILanguageModule
 		Result<InitData> Initialize(const Provider& provider, const Extension& module) override;
 		void Shutdown() override;
-		void OnUpdate([[maybe_unused]] std::chrono::milliseconds dt) override {};
+		void OnUpdate(std::chrono::milliseconds dt) override;
 		void OnMethodExport(const Extension& plugin) override;
 		Result<LoadData> OnPluginLoad(const Extension& plugin) override;
 		void OnPluginStart(const Extension& plugin) override;
@@ -135,7 +216,11 @@ namespace py3lm {
 
 	public:
 		PyObject* GetOrCreateFunctionObject(const Method& method, void* funcAddr);
+		PyObject* CreateExternalFunctionObject(const Method& method, MemAddr addr, const char* name, PyObject* moduleName);
+		PyObject* CreateReleasingFunctionObject(PyObject* function);
 		std::optional<void*> GetOrCreateFunctionValue(const Method& method, PyObject* object);
+		bool ReleaseFunctionValue(PyObject* object);
+		PythonCallbackCounts GetFunctionValueCounts() const;
 		PyObject* CreateVector2Object(const plg::vec2& vector);
 		std::optional<plg::vec2> Vector2ValueFromObject(PyObject* object);
 		PyObject* CreateVector3Object(const plg::vec3& vector);
@@ -145,20 +230,35 @@ namespace py3lm {
 		PyObject* CreateMatrix4x4Object(const plg::mat4x4& matrix);
 		std::optional<plg::mat4x4> Matrix4x4ValueFromObject(PyObject* object);
 		PythonType GetObjectType(PyObject* type) const;
-		PyObject* GetEnumObject(const EnumObject& enumerator, int64_t value) const;
-		void CreateEnumObject(const EnumObject& enumerator, PyObject* moduleDict);
+		PyObject* GetEnumObject(const EnumObject& enumerator, int64_t value);
+		PyObject* GetEnumClass(const EnumObject& enumerator);
+		bool IsEnumObject(PyObject* object) const;
+		void BindEnumObject(const EnumObject& enumerator, PyObject* moduleDict);
 		void ResolveRequiredModule(std::string_view moduleName);
 		std::vector<std::string> ExtractRequiredModules(const std::string& modulePath);
 
+		InterpreterState& GetState() const;
+		PyThreadState* GetThreadState(InterpreterState& state);
 		const std::unique_ptr<Provider>& GetProvider() const { return _provider; }
 		void LogFatal(std::string_view msg) const;
 		void LogError() const;
 
 	private:
-		PyObject* FindPythonMethod(MemAddr addr) const;
+		struct JitCallHolder {
+			JitCall jitCall;
+			MemAddr func;
+		};
+
+		const PythonEnumMap* GetEnumMap(const EnumObject& enumerator);
+		void ClearTypeCache();
 		PyObject* CreateInternalModule(const Extension& plugin, PyObject* moduleObject = nullptr);
 		PyObject* CreateExternalModule(const Extension& plugin, PyObject* moduleObject = nullptr);
+		std::shared_ptr<JitCallHolder> GetOrCreateJitCall(const Method& method, MemAddr addr);
+		void ReleaseJitCalls(const Extension& plugin);
 		void TryCreateModule(const Extension& plugin, bool empty);
+		Result<void> SetupInterpreterState(InterpreterState& state);
+		Result<InterpreterState*> CreatePluginInterpreter();
+		void ReleaseInterpreterState(InterpreterState& state);
 
 	private:
 		std::unique_ptr<Provider> _provider;
@@ -168,37 +268,26 @@ namespace py3lm {
 			PyObject* update = nullptr;
 			PyObject* start = nullptr;
 			PyObject* end = nullptr;
+			std::unordered_map<void*, PyObject*> methods; // exported python functions by JIT address
+			InterpreterState* state = nullptr;
 		};
+		static PyObject* FindPythonMethod(const PluginData& pluginData, MemAddr addr);
 		std::unordered_map<UniqueId, PluginData> _pluginsMap;
-		std::vector<PythonMethodData> _pythonMethods;
-		PyObject* _PluginTypeObject = nullptr;
-		PyObject* _PluginInfoTypeObject = nullptr;
-		PyObject* _Vector2TypeObject = nullptr;
-		PyObject* _Vector3TypeObject = nullptr;
-		PyObject* _Vector4TypeObject = nullptr;
-		PyObject* _Matrix4x4TypeObject = nullptr;
-		PyObject* _ExtractRequiredModulesObject = nullptr;
-		PyObject* _ppsModule = nullptr;
-		PyObject* _enumModule = nullptr;
-		PyObject* _formatException = nullptr;
-		std::vector<std::vector<PyMethodDef>> _moduleMethods;
-		struct JitHolder {
-			JitCallback jitCallback;
-			JitCall jitCall;
-		};
-		std::vector<JitHolder> _moduleFunctions;
-		struct ExternalHolder {
-			JitCallback jitCallback;
-			JitCall jitCall;
-			std::unique_ptr<PyMethodDef> def;
-			PyObject* object;
+		struct UpdateEntry {
+			PyObject* update;
+			InterpreterState* state;
+			std::string name;
 		};
-		std::vector<ExternalHolder> _externalFunctions;
-		std::vector<PythonMethodData> _internalFunctions;
-		PythonExternalMap _externalMap;
-		PythonInternalMap _internalMap;
-		PythonTypeMap _typeMap;
-		PythonExternalEnumMap _externalEnumMap;
-		PythonInternalEnumMap _internalEnumMap;
+		void AddUpdate(UpdateEntry entry);
+		std::vector<UpdateEntry> _updates; // started plugins with plugin_update, grouped by interpreter
+		std::vector<UpdateEntry> _startedUpdates; // started during OnUpdate, added once the loop is done
+		bool _updating = false;
+		// c++ call wrappers by target address and signature, shared by all interpreters. Plans keep their wrapper
+		// alive, so the entries of an ending plugin can be dropped while its function objects still exist.
+		std::map<std::pair<void*, std::string>, std::shared_ptr<JitCallHolder>> _jitCalls;
+		std::mutex _jitCallsMutex;
+		std::vector<std::unique_ptr<InterpreterState>> _states; // main interpreter first
+		mutable std::mutex _statesMutex;
+		uint64_t _statesGeneration = 0; // bumped on shutdown, invalidates per-thread caches
 	};
 }
@@ -0,0 +1,254 @@
+import enum
+import sys
+import threading
+import time
+from plugify.plugin import Plugin, Vector2, Vector3, Vector4, Matrix4x4
+from plugify.pps import (cross_call_master as master)
+
+
+# Times the cross_call_master exports with the signatures of test/cross_call_worker.
+# Run it on two builds of the language module to compare them, the numbers include the
+# native side of the master plugin. CallFunc cases pass a python callable that the master
+# calls back, so they cover the C++ to python direction as well.
+
+ITERATIONS = 20000
+ROUNDS = 5
+
+
+def measure(func, iterations=ITERATIONS, rounds=ROUNDS):
+    """
+    Best of 'rounds' runs, in nanoseconds per call.
+    """
+    for _ in range(iterations // 10):
+        func()
+    best = None
+    for _ in range(rounds):
+        start = time.perf_counter_ns()
+        for _ in range(iterations):
+            func()
+        elapsed = (time.perf_counter_ns() - start) / iterations
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def report(section, cases, iterations=ITERATIONS):
+    print(f'CrossCallBenchmark: {section}')
+    for name, func in cases:
+        try:
+            print(f'  {name:<32} {measure(func, iterations):>10.1f} ns/call')
+        except Exception as e:
+            print(f'  {name:<32} failed: {e!r}')
+
+
+def mock_void():
+    pass
+
+
+def mock_int32():
+    return 1000
+
+
+def mock_string():
+    return 'Hello World'
+
+
+def mock_vec3():
+    return Vector3(1.1, 2.2, 3.3)
+
+
+def mock_string_array():
+    return ['Hello', 'World']
+
+
+def mock_func1(vec3):
+    return int(vec3.x + vec3.y + vec3.z)
+
+
+def mock_func17(ref_val):
+    ref_val += 10
+    return None, ref_val
+
+
+SIGNATURE_CASES = [
+    ('NoParamReturnVoid', master.NoParamReturnVoidCallback),
+    ('NoParamReturnBool', master.NoParamReturnBoolCallback),
+    ('NoParamReturnChar8', master.NoParamReturnChar8Callback),
+    ('NoParamReturnChar16', master.NoParamReturnChar16Callback),
+    ('NoParamReturnInt8', master.NoParamReturnInt8Callback),
+    ('NoParamReturnInt16', master.NoParamReturnInt16Callback),
+    ('NoParamReturnInt32', master.NoParamReturnInt32Callback),
+    ('NoParamReturnInt64', master.NoParamReturnInt64Callback),
+    ('NoParamReturnUInt8', master.NoParamReturnUInt8Callback),
+    ('NoParamReturnUInt16', master.NoParamReturnUInt16Callback),
+    ('NoParamReturnUInt32', master.NoParamReturnUInt32Callback),
+    ('NoParamReturnUInt64', master.NoParamReturnUInt64Callback),
+    ('NoParamReturnPointer', master.NoParamReturnPointerCallback),
+    ('NoParamReturnFloat', master.NoParamReturnFloatCallback),
+    ('NoParamReturnDouble', master.NoParamReturnDoubleCallback),
+    ('NoParamReturnFunction', master.NoParamReturnFunctionCallback),
+    ('NoParamReturnString', master.NoParamReturnStringCallback),
+    ('NoParamReturnAny', master.NoParamReturnAnyCallback),
+    ('NoParamReturnArrayBool', master.NoParamReturnArrayBoolCallback),
+    ('NoParamReturnArrayChar8', master.NoParamReturnArrayChar8Callback),
+    ('NoParamReturnArrayChar16', master.NoParamReturnArrayChar16Callback),
+    ('NoParamReturnArrayInt8', master.NoParamReturnArrayInt8Callback),
+    ('NoParamReturnArrayInt16', master.NoParamReturnArrayInt16Callback),
+    ('NoParamReturnArrayInt32', master.NoParamReturnArrayInt32Callback),
+    ('NoParamReturnArrayInt64', master.NoParamReturnArrayInt64Callback),
+    ('NoParamReturnArrayUInt8', master.NoParamReturnArrayUInt8Callback),
+    ('NoParamReturnArrayUInt16', master.NoParamReturnArrayUInt16Callback),
+    ('NoParamReturnArrayUInt32', master.NoParamReturnArrayUInt32Callback),
+    ('NoParamReturnArrayUInt64', master.NoParamReturnArrayUInt64Callback),
+    ('NoParamReturnArrayPointer', master.NoParamReturnArrayPointerCallback),
+    ('NoParamReturnArrayFloat', master.NoParamReturnArrayFloatCallback),
+    ('NoParamReturnArrayDouble', master.NoParamReturnArrayDoubleCallback),
+    ('NoParamReturnArrayString', master.NoParamReturnArrayStringCallback),
+    ('NoParamReturnArrayAny', master.NoParamReturnArrayAnyCallback),
+    ('NoParamReturnArrayVector2', master.NoParamReturnArrayVec2Callback),
+    ('NoParamReturnArrayVector3', master.NoParamReturnArrayVec3Callback),
+    ('NoParamReturnArrayVector4', master.NoParamReturnArrayVec4Callback),
+    ('NoParamReturnArrayMatrix4x4', master.NoParamReturnArrayMat4x4Callback),
+    ('NoParamReturnVector2', master.NoParamReturnVector2Callback),
+    ('NoParamReturnVector3', master.NoParamReturnVector3Callback),
+    ('NoParamReturnVector4', master.NoParamReturnVector4Callback),
+    ('NoParamReturnMatrix4x4', master.NoParamReturnMatrix4x4Callback),
+    ('Param1', lambda: master.Param1Callback(999)),
+    ('Param2', lambda: master.Param2Callback(888, 9.9)),
+    ('Param3', lambda: master.Param3Callback(777, 8.8, 9.8765)),
+    ('Param4', lambda: master.Param4Callback(666, 7.7, 8.7659, Vector4(100.1, 200.2, 300.3, 400.4))),
+    ('Param5', lambda: master.Param5Callback(555, 6.6, 7.6598, Vector4(-105.1, -205.2, -305.3, -405.4), [])),
+    ('Param6', lambda: master.Param6Callback(444, 5.5, 6.5987, Vector4(110.1, 210.2, 310.3, 410.4), [90000, -100, 20000], 'A')),
+    ('Param7', lambda: master.Param7Callback(333, 4.4, 5.9876, Vector4(-115.1, -215.2, -315.3, -415.4), [800000, 30000, -4000000], 'B', 'red gold')),
+    ('Param8', lambda: master.Param8Callback(222, 3.3, 1.2345, Vector4(120.1, 220.2, 320.3, 420.4), [7000000, 5000000, -600000000], 'C', 'blue ice', 'Z')),
+    ('Param9', lambda: master.Param9Callback(111, 2.2, 5.1234, Vector4(-125.1, -225.2, -325.3, -425.4), [60000000, -700000000, 80000000000], 'D', 'pink metal', 'Y', -100)),
+    ('Param10', lambda: master.Param10Callback(1234, 1.1, 4.5123, Vector4(130.1, 230.2, 330.3, 430.4), [500000000, 90000000000, 1000000000000], 'E', 'green wood', 'X', -200, 0xabeba)),
+    ('ParamRef1', lambda: master.ParamRef1Callback(0)),
+    ('ParamRef2', lambda: master.ParamRef2Callback(0, 0.0)),
+    ('ParamRef3', lambda: master.ParamRef3Callback(0, 0.0, 0.0)),
+    ('ParamRef4', lambda: master.ParamRef4Callback(0, 0.0, 0.0, Vector4())),
+    ('ParamRef5', lambda: master.ParamRef5Callback(0, 0.0, 0.0, Vector4(), [])),
+    ('ParamRef6', lambda: master.ParamRef6Callback(0, 0.0, 0.0, Vector4(), [], '')),
+    ('ParamRef7', lambda: master.ParamRef7Callback(0, 0.0, 0.0, Vector4(), [], '', '')),
+    ('ParamRef8', lambda: master.ParamRef8Callback(0, 0.0, 0.0, Vector4(), [], '', '', '')),
+    ('ParamRef9', lambda: master.ParamRef9Callback(0, 0.0, 0.0, Vector4(), [], '', '', '', 0)),
+    ('ParamRef10', lambda: master.ParamRef10Callback(0, 0.0, 0.0, Vector4(), [], '', '', '', 0, 0)),
+    ('ParamRefArrays', lambda: master.ParamRefVectorsCallback(
+        [True], ['A'], ['A'], [-1], [-1], [-1], [-1], [0], [0], [0], [0], [0], [1.0], [1.0], ['Hi'])),
+    ('ParamAllPrimitives', lambda: master.ParamAllPrimitivesCallback(
+        True, '%', '☢', -1, -1000, -1000000, -1000000000000, 200, 50000, 3000000000, 9999999999, 0xfedcbaabcdef, 0.001, 987654.456789)),
+    ('ParamEnum', lambda: master.ParamEnumCallback(master.Example.Forth, [master.Example.First, master.Example.Second, master.Example.Third])),
+    ('ParamEnumRef', lambda: master.ParamEnumRefCallback(master.Example.First, [master.Example.First, master.Example.First, master.Example.Second])),
+    ('CallFuncVoid', lambda: master.CallFuncVoidCallback(mock_void)),
+    ('CallFuncInt32', lambda: master.CallFuncInt32Callback(mock_int32)),
+    ('CallFuncString', lambda: master.CallFuncStringCallback(mock_string)),
+    ('CallFuncVec3', lambda: master.CallFuncVec3Callback(mock_vec3)),
+    ('CallFuncStringVector', lambda: master.CallFuncStringVectorCallback(mock_string_array)),
+    ('CallFunc1', lambda: master.CallFunc1Callback(mock_func1)),
+    ('CallFunc17', lambda: master.CallFunc17Callback(mock_func17)),
+]
+
+
+class Level(enum.IntEnum):
+    Low = 1
+    High = 2
+
+
+# any[] payloads of 1000 items, the conversion classifies every item
+ANY_ITEMS = 1000
+ANY_PRIMITIVES = [[1, 2.5, 'text', True][i % 4] for i in range(ANY_ITEMS)]
+ANY_MIXED = [[1, 2.5, 'text', True, [1, 2, 3], ['a', 'b'], Vector3(1.0, 2.0, 3.0)][i % 7] for i in range(ANY_ITEMS)]
+ANY_HOMOGENEOUS = list(range(ANY_ITEMS))
+# Needs PY3LM_MARSHAL_SUBCLASSES, reported as failed otherwise
+ANY_SUBCLASSES = [[Level.Low, Level.High, 3][i % 3] for i in range(ANY_ITEMS)]
+
+ANY_ARRAY_CASES = [
+    ('any[] int/float/str/bool', lambda: master.ParamVariantCallback('any', ANY_PRIMITIVES)),
+    ('any[] with lists and vectors', lambda: master.ParamVariantCallback('any', ANY_MIXED)),
+    ('any[] homogeneous int', lambda: master.ParamVariantCallback('any', ANY_HOMOGENEOUS)),
+    ('any[] IntEnum members', lambda: master.ParamVariantCallback('any', ANY_SUBCLASSES)),
+]
+
+
+# string[] payloads of 1000 items: short ASCII names, ASCII chat lines and non-ASCII lines
+STRING_ITEMS = 1000
+STRINGS_SHORT = [f'player_{i:03}' for i in range(STRING_ITEMS)]
+STRINGS_LONG = [f'[{i:04}] ' + 'the quick brown fox jumps over the lazy dog ' * 4 for i in range(STRING_ITEMS)]
+STRINGS_UNICODE = [f'[{i:04}] ' + 'быстрая коричневая лиса ☢ ' * 7 for i in range(STRING_ITEMS)]
+
+
+def string_array_cases(name, strings):
+    def ref_arrays():
+        # Only the string[] parameter is filled, it is converted in and written back out
+        master.ParamRefVectorsCallback([], [], [], [], [], [], [], [], [], [], [], [], [], [], strings)
+    return [
+        (f'string[] ref {name}', ref_arrays),
+        (f'string[] callback {name}', lambda: master.CallFuncStringVectorCallback(lambda: strings)),
+    ]
+
+
+STRING_ARRAY_CASES = [
+    *string_array_cases('short', STRINGS_SHORT),
+    *string_array_cases('long', STRINGS_LONG),
+    *string_array_cases('unicode', STRINGS_UNICODE),
+]
+
+
+# Threads calling exports at the same time. With the GIL the total stays flat, free-threaded builds
+# (PY3LM_FREE_THREADED) should scale until the shared registries or the native side contend.
+CONTENTION_THREADS = [1, 2, 4, 8]
+CONTENTION_CALLS = 20000
+
+CONTENTION_CASES = [
+    ('NoParamReturnInt32', master.NoParamReturnInt32Callback),
+    ('Param6', lambda: master.Param6Callback(444, 5.5, 6.5987, Vector4(110.1, 210.2, 310.3, 410.4), [90000, -100, 20000], 'A')),
+    ('ParamRef4', lambda: master.ParamRef4Callback(0, 0.0, 0.0, Vector4())),
+    ('CallFuncInt32', lambda: master.CallFuncInt32Callback(mock_int32)),
+]
+
+
+def measure_contention(func, thread_count, calls=CONTENTION_CALLS):
+    """
+    Total calls per second of 'thread_count' threads, each making 'calls' calls.
+    """
+    barrier = threading.Barrier(thread_count + 1)
+    errors = []
+
+    def worker():
+        barrier.wait()
+        try:
+            for _ in range(calls):
+                func()
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker) for _ in range(thread_count)]
+    for thread in threads:
+        thread.start()
+    barrier.wait()
+    start = time.perf_counter_ns()
+    for thread in threads:
+        thread.join()
+    elapsed = time.perf_counter_ns() - start
+    if errors:
+        raise errors[0]
+    return thread_count * calls * 1e9 / elapsed
+
+
+def report_contention(cases):
+    gil = getattr(sys, '_is_gil_enabled', lambda: True)()
+    print(f'CrossCallBenchmark: contention ({"GIL" if gil else "free-threaded"})')
+    for name, func in cases:
+        func()
+        for thread_count in CONTENTION_THREADS:
+            try:
+                print(f'  {name:<24} {thread_count} threads {measure_contention(func, thread_count) / 1e6:>8.3f} Mcalls/s')
+            except Exception as e:
+                print(f'  {name:<24} {thread_count} threads failed: {e!r}')
+
+
+class CrossCallBenchmark(Plugin):
+	def plugin_start(self):
+		report('signatures', SIGNATURE_CASES)
+		report('any[] payloads', ANY_ARRAY_CASES, ITERATIONS // 20)
+		report('string[] payloads', STRING_ARRAY_CASES, ITERATIONS // 20)
+		report_contention(CONTENTION_CASES)
@@ -1,5 +1,5 @@
 import sys
-from plugify.plugin import Plugin, Vector2, Vector3, Vector4, Matrix4x4
+from plugify.plugin import Plugin, Vector2, Vector3, Vector4, Matrix4x4, ArrayView, array_views
 from plugify.pps import (cross_call_master as master)
 
 
@@ -66,6 +66,36 @@ def pod_to_string(pod):
     raise TypeError('Non POD type')
 
 
+# Views handed to array_views exports, each must be released by the time the next one runs
+_array_views = []
+
+
+def check_array_views_released():
+    while _array_views:
+        view = _array_views.pop()
+        try:
+            len(view)
+        except ValueError:
+            continue
+        raise AssertionError(f'{view!r} still usable after its call returned')
+
+
+def check_read_only_view(view, expected_type=int):
+    assert isinstance(view, ArrayView)
+    assert view.tolist() == list(view)
+    assert view[0:len(view)] == view.tolist()
+    assert all(isinstance(v, expected_type) for v in view)
+    if len(view):
+        assert view[-1] == view[len(view) - 1]
+        assert memoryview(view).tolist() == view.tolist()
+    try:
+        view.append(0)
+    except TypeError:
+        pass
+    else:
+        raise AssertionError('read-only array view accepted append()')
+
+
 # <<< Test part >>>
 
 class CrossCallWorker(Plugin):
@@ -312,8 +342,12 @@ def param9(a, b, c, d, e, f, g, h, k):
     buffer = f'{a}{b}{c}{d}{e}{f}{g}{h}{k}'
 
 
+@array_views
 def param10(a, b, c, d, e, f, g, h, k, l):
-    buffer = f'{a}{b}{c}{d}{e}{f}{g}{h}{k}{l}'
+    check_array_views_released()
+    check_read_only_view(e)
+    _array_views.append(e)
+    buffer = f'{a}{b}{c}{d}{e.tolist()}{f}{g}{h}{k}{l}'
 
 
 def param_ref1(a):
@@ -352,8 +386,23 @@ def param_ref9(a, b, c, d, e, f, g, h, k):
     return None, -1234, 123.45, -678.9, Vector4(987.65, 432.1, 123.456, 789.123), [-6, -5, -4, -3, -2, -1, 0, 1, 5, 9], 'W', 'Testing, 1 2 3', 'B', 42
 
 
+# Builds the expected array in the caller's vector through the view, returning the view skips the copy back
+@array_views
 def param_ref10(a, b, c, d, e, f, g, h, k, l):
-    return None, 987, -0.123, 456.789, Vector4(-123.456, 0.987, 654.321, -789.123), [-6, -5, -4, -3, -2, -1, 0, 1, 5, 9, 4, -7], 'V', 'Another string', 'C', -444, 0x12345678
+    check_array_views_released()
+    assert isinstance(e, ArrayView)
+    e.clear()
+    assert len(e) == 0
+    e.extend([-6, -5, -4])
+    e.append(-3)
+    e.resize(12)
+    assert e.tolist() == [-6, -5, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0]
+    for i, v in enumerate([-2, -1, 0, 1, 5, 9, 4, -7], start=4):
+        e[i] = v
+    e[-1] = -7
+    assert e.tolist() == [-6, -5, -4, -3, -2, -1, 0, 1, 5, 9, 4, -7]
+    _array_views.append(e)
+    return None, 987, -0.123, 456.789, Vector4(-123.456, 0.987, 654.321, -789.123), e, 'V', 'Another string', 'C', -444, 0x12345678
 
 
 def param_ref_vectors(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15):
@@ -0,0 +1,67 @@
+from plugify.plugin import Plugin, Vector2, Vector3, Vector4, Matrix4x4
+
+
+def check_matrix_element_assignment():
+    mat = Matrix4x4()
+    mat.m[1][2] = 5.0
+    assert mat.m[1][2] == 5.0
+    assert mat.to_list()[1][2] == 5.0
+    mat.m[3][-1] = 7
+    assert mat.m[3][3] == 7.0
+
+
+def check_matrix_row_assignment():
+    mat = Matrix4x4.zero()
+    mat.m[0] = [1.0, 2.0, 3.0, 4.0]
+    assert mat.m[0] == [1.0, 2.0, 3.0, 4.0]
+    other = Matrix4x4.zero()
+    other.m[2] = mat.m[0]
+    assert other.m[2] == [1.0, 2.0, 3.0, 4.0]
+
+
+def check_matrix_view_outlives_access():
+    mat = Matrix4x4()
+    row = mat.m[0]
+    row[1] = 9.0
+    assert mat.m[0][1] == 9.0
+    assert [list(r) for r in mat.m][0] == [1.0, 9.0, 0.0, 0.0]
+    assert mat.m[0][1:3] == [9.0, 0.0]
+
+
+def check_matrix_elements_assignment():
+    mat = Matrix4x4()
+    mat.m = [[float(i * 4 + j) for j in range(4)] for i in range(4)]
+    assert mat.m == [[float(i * 4 + j) for j in range(4)] for i in range(4)]
+    copy = Matrix4x4.zero()
+    copy.m = mat.m
+    assert copy.m == mat.m
+    copy.m[0][0] = 100.0
+    assert mat.m[0][0] == 0.0
+
+
+def check_instance_attributes():
+    for value in (Vector2(1, 2), Vector3(1, 2, 3), Vector4(1, 2, 3, 4), Matrix4x4()):
+        value.tag = 'custom'
+        assert value.tag == 'custom'
+        assert value.__dict__ == {'tag': 'custom'}
+
+
+CHECKS = [
+    check_matrix_element_assignment,
+    check_matrix_row_assignment,
+    check_matrix_view_outlives_access,
+    check_matrix_elements_assignment,
+    check_instance_attributes,
+]
+
+
+class ValueTypes(Plugin):
+	def plugin_start(self):
+		failed = 0
+		for check in CHECKS:
+			try:
+				check()
+			except Exception as e:
+				failed += 1
+				print(f'ValueTypes: {check.__name__} failed: {e!r}')
+		print(f'ValueTypes: {len(CHECKS) - failed}/{len(CHECKS)} checks passed')